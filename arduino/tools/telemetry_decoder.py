@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Decoder for the binary telemetry stream sent on the USART link.
+
+Each sample is sent in a COBS encoded frame ended by a null byte. The decoded
+payload contains, little endian :
+    - sensor identifier (1 byte), bit 7 set when the value is not valid
+    - timestamp in ms since the start of the stream (4 bytes)
+    - value multiplied by 10 (2 bytes)
+    - CRC16 CCITT (polynomial 0x1021, initial value 0xFFFF) of the previous bytes (2 bytes)
+
+The samples are written as CSV lines : time (s), sensor, value, validity.
+
+Usage :
+    telemetry_decoder.py --port /dev/ttyACM0 --start     (needs pyserial)
+    telemetry_decoder.py --file capture.bin
+"""
+
+import argparse
+import struct
+import sys
+
+FRAME_DELIMITER = 0x00
+PAYLOAD_SIZE = 9
+INVALID_FLAG = 0x80
+
+# Same order as the sensor configuration table (sensor_configuration.cpp)
+SENSORS = [("T", "degC"), ("H", "%"), ("P", "hPa")]
+
+# Characters sent to the debug menu to start the stream : enter debug mode, telemetry menu, start
+START_SEQUENCE = b"a31"
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            if crc & 0x8000:
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF
+            else:
+                crc = (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_decode(frame):
+    data = bytearray()
+    idx = 0
+    while idx < len(frame):
+        code = frame[idx]
+        if code == 0 or idx + code > len(frame):
+            return None
+        data += frame[idx + 1:idx + code]
+        idx += code
+        if code < 0xFF and idx < len(frame):
+            data.append(0)
+    return bytes(data)
+
+
+def decode_frame(frame):
+    """Returns (time_s, sensor_id, value, validity) or None if the frame is corrupted."""
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) != PAYLOAD_SIZE:
+        return None
+
+    sensor, time_ms, value, crc = struct.unpack("<BIhH", payload)
+    if crc16(payload[:-2]) != crc:
+        return None
+
+    return time_ms / 1000.0, sensor & ~INVALID_FLAG, value / 10.0, not (sensor & INVALID_FLAG)
+
+
+def sensor_name(sensor_id):
+    if sensor_id < len(SENSORS):
+        return "%s (%s)" % SENSORS[sensor_id]
+    return "capteur %d" % sensor_id
+
+
+def decode_stream(read, out):
+    buffer = bytearray()
+    errors = 0
+
+    out.write("temps (s);capteur;valeur;valide\n")
+
+    while True:
+        chunk = read()
+        if chunk is None:
+            break
+
+        for byte in chunk:
+            if byte != FRAME_DELIMITER:
+                buffer.append(byte)
+                continue
+
+            # The text sent before the first frame is rejected here
+            sample = decode_frame(bytes(buffer)) if buffer else None
+            buffer = bytearray()
+
+            if sample is None:
+                errors += 1
+                continue
+
+            time_s, sensor, value, validity = sample
+            out.write("%.3f;%s;%.1f;%d\n" % (time_s, sensor_name(sensor), value, validity))
+            out.flush()
+
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Binary telemetry stream decoder")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial port connected to the board")
+    source.add_argument("--file", help="raw capture of the stream")
+    parser.add_argument("--baud", type=int, default=9600, help="baud rate of the serial port")
+    parser.add_argument("--start", action="store_true", help="start the stream from the debug menu")
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+
+        link = serial.Serial(args.port, args.baud, stopbits=serial.STOPBITS_TWO, timeout=1)
+        if args.start:
+            link.write(START_SEQUENCE)
+
+        def read():
+            # An empty read is a timeout, the stream is decoded until interrupted
+            return link.read(64)
+    else:
+        capture = open(args.file, "rb")
+
+        def read():
+            return capture.read(4096) or None
+
+    try:
+        errors = decode_stream(read, sys.stdout)
+    except KeyboardInterrupt:
+        return 0
+
+    sys.stderr.write("%d trames rejetees\n" % errors)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
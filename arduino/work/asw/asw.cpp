@@ -9,8 +9,9 @@
 
 #include <stdlib.h>
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 
-#include "../lib/LinkedList/LinkedList.h"
+#include "../lib/StaticPool/StaticPool.h"
 #include "../lib/string/String.h"
 
 #include "../bsw/usart/usart.h"
@@ -21,10 +22,14 @@
 
 #include "../bsw/bsw.h"
 
+#include "../scheduler/scheduler.h"
+
 #include "sensors_mgt/SensorManagement.h"
 #include "debug_ift/DebugInterface.h"
 #include "debug_mgt/DebugManagement.h"
+#include "telemetry/Telemetry.h"
 #include "display_ift/DisplayInterface.h"
+#include "display_mgt/page_configuration.h"
 #include "display_mgt/DisplayManagement.h"
 #include "keepAliveLed/keepAliveLed.h"
 #include "time_mgt/TimeManagement.h"
@@ -41,15 +46,21 @@ void asw_init()
 		if(p_global_ASW_DebugInterface == 0)
 			p_global_ASW_DebugInterface = new DebugInterface();
 
-		p_global_ASW_DebugInterface->sendString((uint8_t*)"\fMode debug actif !\n");
+		p_global_ASW_DebugInterface->sendString(FSTR("\fMode debug actif !\n"));
 	}
 	else
 		p_global_ASW_DebugInterface = 0;
 
 
-	/* Debug management object is created on user request by USART interrupt */
+	/* Debug management object is created on user request by the received data management task, activated by USART interrupt */
 	p_global_ASW_DebugManagement = 0;
 
+	/* Telemetry object is created on user request by the debug menu */
+	p_global_ASW_Telemetry = 0;
+
+	if(isDebugModeActivated)
+		DebugManagement::rx_task_handle = p_global_scheduler->addEventTask(&DebugManagement::DebugRxManagement_task, TASK_PRIO_LOW, p_global_ASW_DebugInterface);
+
 
 	/* Time management activation */
 	if(ASW_init_cnf.isTimeMgtActivated)
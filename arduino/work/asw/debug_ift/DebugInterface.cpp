@@ -36,9 +36,13 @@ void DebugInterface::sendString(String* str)
 
 void DebugInterface::sendString(uint8_t* str)
 {
-	String strToSend;
-	strToSend.appendString(str);
-	sendString(&strToSend);
+	/* The chain is sent directly, without copy */
+	usart_drv_ptr->usart_sendString(str);
+}
+
+void DebugInterface::sendString(const FlashString* str)
+{
+	usart_drv_ptr->usart_sendString(str);
 }
 
 void DebugInterface::sendChar(uint8_t chr)
@@ -46,13 +50,18 @@ void DebugInterface::sendChar(uint8_t chr)
 	usart_drv_ptr->usart_sendByte(chr);
 }
 
+bool DebugInterface::sendBuffer(uint8_t* data, uint16_t size)
+{
+	return usart_drv_ptr->usart_sendBuffer(data, size);
+}
+
 void DebugInterface::sendInteger(uint16_t data, uint8_t base)
 {
 	/* If the base in not between 2 and 36, 10 is used as default */
 	if((base > 36) && (base < 2))
 		base = 10;
 
-	String strToSend;
+	StaticString<STRING_INTEGER_MAX_SIZE> strToSend;
 
 	strToSend.appendInteger(data, base);
 
@@ -61,7 +70,7 @@ void DebugInterface::sendInteger(uint16_t data, uint8_t base)
 
 void DebugInterface::sendBool(bool data, bool isText)
 {
-	String str;
+	StaticString<STRING_INTEGER_MAX_SIZE> str;
 
 	str.appendBool(data, isText);
 
@@ -12,7 +12,7 @@
 
 
 
-#define USART_BAUDRATE (uint16_t)9600 /*!< usart connection to PC uses a baud rate of 9600 */
+#define USART_BAUDRATE (uint32_t)9600 /*!< usart connection to PC uses a baud rate of 9600 at start-up, it can be changed in the debug menu */
 
 /*!
  * @brief Class used for debugging on usart link
@@ -60,12 +60,20 @@ public:
 	/*!
 	 * @brief Send a chain of characters on USART link
 	 * @details This function sends the requested chain of characters on USART link by calling driver's transmission function.
-	 * 			The chain is first converted into a string object.
 	 * @param [in] str Pointer to the chain to send.
 	 * @return Nothing
 	 */
 	void sendString(uint8_t* str);
 
+	/*!
+	 * @brief Send a chain of characters stored in flash memory on USART link
+	 * @details This function sends the requested chain of characters on USART link by calling driver's transmission function.
+	 * 			The characters are read in flash memory by the driver, they are not copied in RAM.
+	 * @param [in] str Pointer to the chain to send, in flash memory.
+	 * @return Nothing
+	 */
+	void sendString(const FlashString* str);
+
 	/*!
 	 * @brief Send a single character on USART link
 	 * @details This function sends the requested character on USART link by calling driver's transmission function.
@@ -74,14 +82,46 @@ public:
 	 */
 	void sendChar(uint8_t chr);
 
+	/*!
+	 * @brief Send a binary buffer on USART link
+	 * @details This function sends the requested bytes on USART link by calling driver's transmission function. The bytes are sent without any conversion.
+	 * @param [in] data Pointer to the bytes to send
+	 * @param [in] size Number of bytes to send
+	 * @return True if the whole buffer has been queued, false otherwise
+	 */
+	bool sendBuffer(uint8_t* data, uint16_t size);
+
+	/*!
+	 * @brief Transmission policy setting function
+	 * @details This function sets the behavior of the USART driver when its transmission buffer is full.
+	 * @param [in] policy Requested policy
+	 * @return Nothing
+	 */
+	inline void setTxPolicy(T_usart_tx_policy policy)
+	{
+		usart_drv_ptr->setTxPolicy(policy);
+	}
+
+	/*!
+	 * @brief Baud rate setting function
+	 * @details This function changes the baud rate of the USART link, after the end of the transmission of the data already sent.
+	 * @param [in] baudrate Requested baud rate
+	 * @return True if the baud rate has been changed, false if it can not be generated
+	 */
+	inline bool setBaudRate(uint32_t baudrate)
+	{
+		return usart_drv_ptr->setBaudRate(baudrate);
+	}
+
 	/*!
 	 * @brief USART read function
-	 * @details This function will read the last received byte on USART link
-	 * @return Received byte
+	 * @details This function reads the oldest received byte on USART link which has not been read yet
+	 * @param [out] data Received byte
+	 * @return True if a byte has been read, false if no byte is waiting
 	 */
-	inline uint8_t read()
+	inline bool read(uint8_t* data)
 	{
-		return usart_drv_ptr->usart_read();
+		return usart_drv_ptr->usart_read(data);
 	}
 
 	/*!
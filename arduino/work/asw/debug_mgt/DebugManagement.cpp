@@ -10,9 +10,10 @@
 #include <avr/io.h>
 #include <stdlib.h>
 #include <avr/wdt.h>
+#include <avr/pgmspace.h>
 
 #include "../../lib/string/String.h"
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 
 #include "../../scheduler/scheduler.h"
 
@@ -25,6 +26,7 @@
 #include "../sensors/HumSensor/HumSensor.h"
 #include "../sensors_mgt/SensorManagement.h"
 #include "../debug_ift/DebugInterface.h"
+#include "../telemetry/Telemetry.h"
 #include "DebugManagement.h"
 
 #include "../asw.h"
@@ -32,14 +34,19 @@
 
 DebugManagement* p_global_ASW_DebugManagement;
 
+TaskHandle_t DebugManagement::rx_task_handle = SCHEDULER_INVALID_HANDLE;
+
 /* TODO : display current timeout value in timeout update menu  -> impact on string class */
 
 /*!
  * @brief Main menu of debug mode
  */
-const uint8_t str_debug_main_menu[] =
+const uint8_t str_debug_main_menu[] PROGMEM =
 		"Menu principal :  \n"
 		"    1 : Watchdog\n"
+		"    2 : Profilage des taches\n"
+		"    3 : Telemetrie binaire\n"
+		"    4 : Vitesse de liaison\n"
 		"\n"
 		"    r : Reset du systeme\n"
 		"    q : Quitter debug\n";
@@ -47,7 +54,7 @@ const uint8_t str_debug_main_menu[] =
 /*!
  * @brief Watchdog menu of debug mode
  */
-const uint8_t str_debug_wdg_menu[] =
+const uint8_t str_debug_wdg_menu[] PROGMEM =
 		"Menu watchdog : \n"
 		"    1 : Changer timeout\n"
 		"    2 : Afficher valeur actuelle du timeout\n"
@@ -55,10 +62,56 @@ const uint8_t str_debug_wdg_menu[] =
 		"\n"
 		"    q : Retour\n";
 
+/*!
+ * @brief Task profiler menu of debug mode
+ */
+const uint8_t str_debug_profiler_menu[] PROGMEM =
+		"Profilage des taches : \n"
+		"    1 : Remise a zero des statistiques\n"
+		"    2 : Repartition des taches\n"
+		"\n"
+		"    q : Retour\n";
+
+/*!
+ * @brief Telemetry menu of debug mode
+ */
+const uint8_t str_debug_telemetry_menu[] PROGMEM =
+		"Telemetrie binaire : \n"
+		"    1 : Demarrer le flux\n"
+		"    2 : Changer la decimation\n"
+		"\n"
+		"    q : Retour\n";
+
+/*!
+ * @brief Decimation factors proposed in the telemetry menu
+ */
+const uint8_t debug_telemetry_decimation_list[] PROGMEM = {1, 2, 5, 10, 30};
+
+/*!
+ * @brief Baud rate selection menu of debug mode
+ */
+const uint8_t str_debug_baudrate_menu[] PROGMEM =
+		"Selection de la vitesse de liaison : \n"
+		"    0 : 9600 bauds\n"
+		"    1 : 19200 bauds\n"
+		"    2 : 38400 bauds\n"
+		"    3 : 57600 bauds\n"
+		"    4 : 115200 bauds\n"
+		"    5 : 250000 bauds\n"
+		"    6 : 500000 bauds\n"
+		"    7 : 1000000 bauds\n"
+		"\n"
+		"    q : Retour\n";
+
+/*!
+ * @brief Baud rates proposed in the baud rate selection menu, in the order of the menu
+ */
+const uint32_t debug_baudrate_list[] PROGMEM = {9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000};
+
 /*!
  * @brief Watchdog timeout update selection
  */
-const uint8_t str_debug_wdg_timeout_update_selection[] =
+const uint8_t str_debug_wdg_timeout_update_selection[] PROGMEM =
 		"Selection du timeout watchdog : \n"
 		"    0 : 15 ms\n"
 		"    1 : 30 ms\n"
@@ -76,27 +129,57 @@ const uint8_t str_debug_wdg_timeout_update_selection[] =
 /*!
  * @brief Info menu string in case a wrong selection has been performed
  */
-const uint8_t str_debug_info_message_wrong_menu_selection[] = "Impossible de faire ca... !";
+const uint8_t str_debug_info_message_wrong_menu_selection[] PROGMEM = "Impossible de faire ca... !";
 
 /*!
  * @brief Info menu string in case the watchdog timeout value has been updated
  */
-const uint8_t str_debug_info_message_wdg_tmo_updated[] = "Valeur modifiee !";
+const uint8_t str_debug_info_message_wdg_tmo_updated[] PROGMEM = "Valeur modifiee !";
 
 /*!
  * @brief Info menu string displaying the current value of the watchdog timeout
  */
-const uint8_t str_debug_info_message_wdg_tmo_value[] = "Valeur du timeout watchdog (ms) : ";
+const uint8_t str_debug_info_message_wdg_tmo_value[] PROGMEM = "Valeur du timeout watchdog (ms) : ";
 
 /*!
  * @brief Info menu string displayed when the watchdog has been disabled
  */
-const uint8_t str_debug_info_message_wdg_disabled[] = "Watchdog inactif !";
+const uint8_t str_debug_info_message_wdg_disabled[] PROGMEM = "Watchdog inactif !";
 
 /*!
  * @brief Info menu string displayed when the watchdog has been enabled
  */
-const uint8_t str_debug_info_message_wdg_enabled[] = "Watchdog actif !";
+const uint8_t str_debug_info_message_wdg_enabled[] PROGMEM = "Watchdog actif !";
+
+/*!
+ * @brief Info menu string displayed when the task profiles have been reset
+ */
+const uint8_t str_debug_info_message_profiles_reset[] PROGMEM = "Statistiques remises a zero !";
+
+/*!
+ * @brief Info menu string displayed when the task phases have been computed again
+ */
+const uint8_t str_debug_info_message_phases_balanced[] PROGMEM = "Taches reparties !";
+
+/*!
+ * @brief Info menu string displaying the current decimation factor of the telemetry stream
+ */
+const uint8_t str_debug_info_message_telemetry_decimation[] PROGMEM = "Decimation : 1 echantillon sur ";
+
+/*!
+ * @brief Info menu string displayed when the telemetry can not be used because the sensors are disabled
+ */
+const uint8_t str_debug_info_message_sensors_disabled[] PROGMEM = "Les capteurs sont desactives...";
+
+/*!
+ * @brief Info menu string displayed when the baud rate has been updated
+ */
+const uint8_t str_debug_info_message_baudrate_updated[] PROGMEM = "Vitesse modifiee !";
+
+/*!
+ * @brief Info menu string displayed when the baud rate can not be generated
+ */
+const uint8_t str_debug_info_message_baudrate_error[] PROGMEM = "Vitesse impossible !";
 
 
 
@@ -118,15 +201,15 @@ DebugManagement::DebugManagement()
 	debug_state.main_state = MAIN_MENU;
 	debug_state.wdg_state = WDG_MAIN;
 
-	menu_string_ptr = (uint8_t*)str_debug_main_menu;
-	info_string_ptr = new String();
+	menu_string_ptr = FLASH_STRING(str_debug_main_menu);
+	info_string_ptr = &info_string;
 	isInfoStringDisplayed = false;
 
 	/* Display data now to avoid blank screen until the task is called by scheduler */
 	DisplayData();
 
 	/* Start display of data periodically */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&DebugManagement::DisplayPeriodicData_task), PERIOD_MS_TASK_DISPLAY_DEBUG_DATA);
+	display_task_handle = p_global_scheduler->addPeriodicTask(&DebugManagement::DisplayPeriodicData_task, PERIOD_MS_TASK_DISPLAY_DEBUG_DATA, TASK_PRIO_LOW, this);
 }
 
 void DebugManagement::DisplayData()
@@ -154,14 +237,14 @@ void DebugManagement::DisplayData()
 	{
 		for(uint8_t i=0; i<sensorMgt_ptr->getSensorCount(); i++)
 		{
-			String str;
+			StaticString<SENSOR_MGT_STRING_MAX_SIZE> str;
 			sensorMgt_ptr->getFullStringFormattedValue(i, &str);
 			debug_ift_ptr->sendString(&str);
 			debug_ift_ptr->nextLine();
 		}
 	}
 	else
-		debug_ift_ptr->sendString((uint8_t*)"Les capteurs sont desactives...\n");
+		debug_ift_ptr->sendString(FSTR("Les capteurs sont desactives...\n"));
 
 
 	/* Skip 1 line */
@@ -170,19 +253,23 @@ void DebugManagement::DisplayData()
 	/* Write CPU load data */
 	if(p_global_BSW_cpuload !=0)
 	{
-		debug_ift_ptr->sendString((uint8_t*)"Charge CPU :\n");
-		debug_ift_ptr->sendString((uint8_t*)"    Actuelle : ");
+		debug_ift_ptr->sendString(FSTR("Charge CPU :\n"));
+		debug_ift_ptr->sendString(FSTR("    Actuelle : "));
 		debug_ift_ptr->sendInteger(p_global_BSW_cpuload->getCurrrentCPULoad(),10);
-		debug_ift_ptr->sendString((uint8_t*)"\n    Moyenne : ");
+		debug_ift_ptr->sendString(FSTR("\n    Moyenne : "));
 		debug_ift_ptr->sendInteger(p_global_BSW_cpuload->getAverageCPULoad(),10);
-		debug_ift_ptr->sendString((uint8_t*)"\n    Max : ");
+		debug_ift_ptr->sendString(FSTR("\n    Max : "));
 		debug_ift_ptr->sendInteger(p_global_BSW_cpuload->getMaxCPULoad(),10);
 	}
 	else
 	{
-		debug_ift_ptr->sendString((uint8_t*)"Charge CPU non disponible\n");
+		debug_ift_ptr->sendString(FSTR("Charge CPU non disponible\n"));
 	}
 
+	/* Write task profiles */
+	if(debug_state.main_state == PROFILER_MENU)
+		DisplayTaskProfiles();
+
 	if(isInfoStringDisplayed)
 	{
 		info_string_ptr->Clear();
@@ -192,20 +279,56 @@ void DebugManagement::DisplayData()
 		isInfoStringDisplayed = true;
 }
 
-void DebugManagement::DisplayPeriodicData_task()
+void DebugManagement::DisplayPeriodicData_task(void* context)
 {
-	p_global_ASW_DebugManagement->DisplayData();
+	((DebugManagement*)context)->DisplayData();
 }
 
+void DebugManagement::DebugRxManagement_task(void* context)
+{
+	bool quit;
+	bool isDisplayNeeded = false;
+	uint8_t rcv_char;
 
+	/* Process all the characters received since the last call */
+	while(((DebugInterface*)context)->read(&rcv_char))
+	{
+		/* If the debug mode is started */
+		if(p_global_ASW_DebugManagement != 0)
+		{
+			quit = p_global_ASW_DebugManagement->DebugModeManagement(rcv_char);
+
+			if(quit)
+			{
+				delete p_global_ASW_DebugManagement;
+				p_global_ASW_DebugManagement = 0;
+				isDisplayNeeded = false;
+			}
+			else
+				isDisplayNeeded = true;
+		}
+		else if(rcv_char == 'a')
+		{
+			/* The binary frames shall not be mixed with the menu */
+			if((p_global_ASW_Telemetry != 0) && p_global_ASW_Telemetry->isActive())
+				p_global_ASW_Telemetry->stop();
+
+			p_global_ASW_DebugManagement = new DebugManagement();
+		}
+	}
+
+	/* Force display update, only once for all the received characters */
+	if(isDisplayNeeded && (p_global_ASW_DebugManagement != 0))
+		p_global_ASW_DebugManagement->DisplayData();
+}
 
 
-bool DebugManagement::DebugModeManagement()
+
+
+bool DebugManagement::DebugModeManagement(uint8_t rcv_char)
 {
 	bool quit = false;
 
-	uint8_t rcv_char = debug_ift_ptr->read();
-
 	/* switch on menu state */
 	switch(debug_state.main_state)
 	{
@@ -217,11 +340,19 @@ bool DebugManagement::DebugModeManagement()
 	case WDG_MENU:
 		WatchdogMenuManagement(rcv_char);
 		break;
-	}
 
-	/* Force display update */
-	if(!quit)
-		DisplayData();
+	case PROFILER_MENU:
+		ProfilerMenuManagement(rcv_char);
+		break;
+
+	case TELEMETRY_MENU:
+		quit = TelemetryMenuManagement(rcv_char);
+		break;
+
+	case BAUDRATE_MENU:
+		BaudRateMenuManagement(rcv_char);
+		break;
+	}
 
 	return quit;
 
@@ -229,13 +360,13 @@ bool DebugManagement::DebugModeManagement()
 
 void DebugManagement::exitDebugMenu()
 {
-	debug_ift_ptr->sendString((uint8_t*)"\fBye !");
-	p_global_scheduler->removePeriodicTask((TaskPtr_t)&DebugManagement::DisplayPeriodicData_task);
+	debug_ift_ptr->sendString(FSTR("\fBye !"));
+	p_global_scheduler->removeTask(display_task_handle);
 }
 
 void DebugManagement::systemReset()
 {
-	debug_ift_ptr->sendString((uint8_t*)"\fReset !");
+	debug_ift_ptr->sendString(FSTR("\fReset !"));
 	p_global_BSW_wdg->SystemReset();
 }
 
@@ -254,14 +385,14 @@ void DebugManagement::WatchdogMenuManagement(uint8_t rcv_char)
 		 * Go to the next menu and display current timeout value
 		 */
 		case '1':
-			menu_string_ptr = (uint8_t*)str_debug_wdg_timeout_update_selection;
+			menu_string_ptr = FLASH_STRING(str_debug_wdg_timeout_update_selection);
 			debug_state.wdg_state = WDG_TMO_UPDATE;
 			break;
 		/* User choice : display TMO value
 		 * Get the timeout value from watchdog class and displays it in info string
 		 */
 		case '2':
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_tmo_value);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_tmo_value));
 			info_string_ptr->appendInteger(p_global_BSW_wdg->getTMOValue(), 10);
 			break;
 		/* User choice : enable/disable watchdog
@@ -271,17 +402,17 @@ void DebugManagement::WatchdogMenuManagement(uint8_t rcv_char)
 		case '3':
 			status = p_global_BSW_wdg->SwitchWdg();
 			if(status)
-				info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_enabled);
+				info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_enabled));
 			else
-				info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_disabled);
+				info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_disabled));
 			break;
 		/* User choice : go back to main menu */
 		case 'q':
 			debug_state.main_state = MAIN_MENU;
-			menu_string_ptr = (uint8_t*)str_debug_main_menu;
+			menu_string_ptr = FLASH_STRING(str_debug_main_menu);
 			break;
 		default:
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wrong_menu_selection);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
 			break;
 		}
 		break;
@@ -295,7 +426,7 @@ void DebugManagement::WatchdogMenuManagement(uint8_t rcv_char)
 		{
 		case 'a':
 			debug_state.wdg_state = WDG_MAIN;
-			menu_string_ptr = (uint8_t*)str_debug_wdg_menu;
+			menu_string_ptr = FLASH_STRING(str_debug_wdg_menu);
 			break;
 		case '0':
 			new_tmo = WDG_TMO_15MS;
@@ -328,7 +459,7 @@ void DebugManagement::WatchdogMenuManagement(uint8_t rcv_char)
 			new_tmo = WDG_TMO_8S;
 			break;
 		default:
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wrong_menu_selection);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
 			break;
 		}
 
@@ -336,8 +467,8 @@ void DebugManagement::WatchdogMenuManagement(uint8_t rcv_char)
 		{
 			p_global_BSW_wdg->timeoutUpdate(new_tmo);
 			debug_state.wdg_state = WDG_MAIN;
-			menu_string_ptr = (uint8_t*)str_debug_wdg_menu;
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_tmo_updated);
+			menu_string_ptr = FLASH_STRING(str_debug_wdg_menu);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_tmo_updated));
 		}
 		break;
 	}
@@ -357,11 +488,37 @@ bool DebugManagement::MainMenuManagement(uint8_t rcv_char)
 	case '1' :
 		debug_state.main_state = WDG_MENU;
 		debug_state.wdg_state = WDG_MAIN;
-		menu_string_ptr = (uint8_t*)str_debug_wdg_menu;
+		menu_string_ptr = FLASH_STRING(str_debug_wdg_menu);
 		if(p_global_BSW_wdg->isEnabled())
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_enabled);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_enabled));
+		else
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wdg_disabled));
+		break;
+	/* User choice : go to task profiler menu */
+	case '2' :
+		debug_state.main_state = PROFILER_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_profiler_menu);
+		break;
+	/* User choice : go to telemetry menu
+	 * The telemetry needs the sensors, display the current decimation in the info string
+	 */
+	case '3' :
+		if(sensorMgt_ptr != 0)
+		{
+			if(p_global_ASW_Telemetry == 0)
+				p_global_ASW_Telemetry = new Telemetry();
+
+			debug_state.main_state = TELEMETRY_MENU;
+			menu_string_ptr = FLASH_STRING(str_debug_telemetry_menu);
+			setDecimationInfoMessage();
+		}
 		else
-			info_string_ptr->appendString((uint8_t*)str_debug_info_message_wdg_disabled);
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_sensors_disabled));
+		break;
+	/* User choice : go to baud rate menu */
+	case '4' :
+		debug_state.main_state = BAUDRATE_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_baudrate_menu);
 		break;
 	case 'q':
 		exitDebugMenu();
@@ -371,9 +528,187 @@ bool DebugManagement::MainMenuManagement(uint8_t rcv_char)
 		systemReset();
 		break;
 	default:
-		info_string_ptr->appendString((uint8_t*)str_debug_info_message_wrong_menu_selection);
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
 		break;
 	}
 
 	return quit;
 }
+
+void DebugManagement::ProfilerMenuManagement(uint8_t rcv_char)
+{
+	switch (rcv_char)
+	{
+	/* User choice : reset statistics */
+	case '1':
+		p_global_scheduler->resetTaskProfiles();
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_profiles_reset));
+		break;
+	/* User choice : spread the tasks using the measured execution times */
+	case '2':
+		p_global_scheduler->balanceTaskPhases();
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_phases_balanced));
+		break;
+	/* User choice : go back to main menu */
+	case 'q':
+		debug_state.main_state = MAIN_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_main_menu);
+		break;
+	default:
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
+		break;
+	}
+}
+
+bool DebugManagement::TelemetryMenuManagement(uint8_t rcv_char)
+{
+	bool quit = false;
+	uint8_t i = 0;
+
+	switch (rcv_char)
+	{
+	/* User choice : start the stream and leave the debug mode */
+	case '1':
+		startTelemetry();
+		quit = true;
+		break;
+	/* User choice : select the next decimation factor of the list */
+	case '2':
+		while((i < sizeof(debug_telemetry_decimation_list)) && (pgm_read_byte(&debug_telemetry_decimation_list[i]) != p_global_ASW_Telemetry->getDecimation()))
+			i++;
+
+		i++;
+		if(i >= sizeof(debug_telemetry_decimation_list))
+			i = 0;
+
+		p_global_ASW_Telemetry->setDecimation(pgm_read_byte(&debug_telemetry_decimation_list[i]));
+		setDecimationInfoMessage();
+		break;
+	/* User choice : go back to main menu */
+	case 'q':
+		debug_state.main_state = MAIN_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_main_menu);
+		break;
+	default:
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
+		break;
+	}
+
+	return quit;
+}
+
+void DebugManagement::BaudRateMenuManagement(uint8_t rcv_char)
+{
+	uint8_t idx;
+
+	/* User choice : go back to main menu */
+	if(rcv_char == 'q')
+	{
+		debug_state.main_state = MAIN_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_main_menu);
+		return;
+	}
+
+	idx = rcv_char - '0';
+
+	if(idx < (sizeof(debug_baudrate_list)/sizeof(uint32_t)))
+	{
+		/* The new baud rate is applied after the end of the transmission of the current screen */
+		if(debug_ift_ptr->setBaudRate(pgm_read_dword(&debug_baudrate_list[idx])))
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_baudrate_updated));
+		else
+			info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_baudrate_error));
+
+		debug_state.main_state = MAIN_MENU;
+		menu_string_ptr = FLASH_STRING(str_debug_main_menu);
+	}
+	else
+		info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_wrong_menu_selection));
+}
+
+void DebugManagement::startTelemetry()
+{
+	debug_ift_ptr->sendString(FSTR("\fTelemetrie active, 'a' pour revenir au menu\n"));
+	p_global_scheduler->removeTask(display_task_handle);
+	p_global_ASW_Telemetry->start();
+}
+
+void DebugManagement::setDecimationInfoMessage()
+{
+	info_string_ptr->Clear();
+	info_string_ptr->appendString(FLASH_STRING(str_debug_info_message_telemetry_decimation));
+	info_string_ptr->appendInteger(p_global_ASW_Telemetry->getDecimation(), 10);
+}
+
+void DebugManagement::DisplayTaskProfiles()
+{
+	TaskProfile_t profile;
+
+	debug_ift_ptr->sendString(FSTR("\n\nProfils des taches :\n"));
+
+	for(uint8_t i = 0; i < SCHEDULER_MAX_TASK_NB; i++)
+	{
+		if(!p_global_scheduler->getTaskProfile(i, &profile))
+			continue;
+
+		/* Task is identified by its number and the address of its function */
+		debug_ift_ptr->sendString(FSTR("    Tache "));
+		debug_ift_ptr->sendInteger(i, 10);
+		debug_ift_ptr->sendString(FSTR(" (0x"));
+		debug_ift_ptr->sendInteger((uint16_t)(uintptr_t)profile.TaskPtr, 16);
+		debug_ift_ptr->sendString(FSTR(") : "));
+		debug_ift_ptr->sendInteger(profile.count, 10);
+		debug_ift_ptr->sendString(FSTR(" appels"));
+
+		if(profile.count != 0)
+		{
+			debug_ift_ptr->sendString(FSTR(", min "));
+			sendDuration(profile.min_ticks);
+			debug_ift_ptr->sendString(FSTR(", moy "));
+			sendDuration(scheduler::getAverageTicks(&profile));
+			debug_ift_ptr->sendString(FSTR(", max "));
+			sendDuration(profile.max_ticks);
+		}
+
+		debug_ift_ptr->sendString(FSTR(", WCET "));
+		sendDuration(profile.wcet_ticks);
+
+		/* Missed deadlines */
+		if(profile.miss_count != 0)
+		{
+			debug_ift_ptr->sendString(FSTR(", echeances manquees "));
+			debug_ift_ptr->sendInteger(profile.miss_count, 10);
+			debug_ift_ptr->sendString(FSTR(" (pire retard "));
+			sendDuration(profile.worst_lateness_ticks);
+			debug_ift_ptr->sendString(FSTR(", dernier PIT "));
+			debug_ift_ptr->sendInteger((uint16_t)profile.last_miss_pit, 10);
+			debug_ift_ptr->sendChar((uint8_t)')');
+		}
+
+		debug_ift_ptr->nextLine();
+	}
+
+	debug_ift_ptr->sendString(FSTR("    Depassements de passe : "));
+	debug_ift_ptr->sendInteger(p_global_scheduler->getOverrunCount(), 10);
+	debug_ift_ptr->nextLine();
+
+	debug_ift_ptr->sendString(FSTR("    Charge max par PIT : "));
+	sendDuration(p_global_scheduler->getWorstTickLoad());
+	debug_ift_ptr->nextLine();
+}
+
+void DebugManagement::sendDuration(uint32_t ticks)
+{
+	uint32_t duration_us = (ticks * 1000) / SCHEDULER_TICKS_PER_MS;
+
+	if(duration_us < 10000)
+	{
+		debug_ift_ptr->sendInteger((uint16_t)duration_us, 10);
+		debug_ift_ptr->sendString(FSTR(" us"));
+	}
+	else
+	{
+		debug_ift_ptr->sendInteger((uint16_t)(duration_us / 1000), 10);
+		debug_ift_ptr->sendString(FSTR(" ms"));
+	}
+}
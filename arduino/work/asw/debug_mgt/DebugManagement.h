@@ -12,6 +12,7 @@
 
 #define PERIOD_MS_TASK_DISPLAY_DEBUG_DATA  5000 /*!< Period for displaying temperature and humidity data */
 #define PERIOD_MS_TASK_DISPLAY_CPU_LOAD 5000 /*!< Period for displaying CPU load data */
+#define DEBUG_MGT_INFO_STRING_SIZE 64 /*!< Maximum size of the info message */
 
 
 /*!
@@ -21,6 +22,9 @@ typedef enum
 {
 	MAIN_MENU, /*!< Init state : main menu is displayed */
 	WDG_MENU,  /*!< Watchdog state : watchdog menu is displayed */
+	PROFILER_MENU, /*!< Profiler state : task profiles are displayed */
+	TELEMETRY_MENU, /*!< Telemetry state : binary telemetry menu is displayed */
+	BAUDRATE_MENU, /*!< Baud rate state : baud rate selection menu is displayed */
 }
 debug_mgt_main_menu_state_t;
 
@@ -63,9 +67,23 @@ public:
 	/*!
 	 * @brief Displays periodic data on usart link
 	 * @details This task displays the menu and periodic data (temperature, humidity and CPU load) on usart screen. It only calls the function DisplayData.
+	 * @param [in] context Pointer to the debug management object
 	 * @return Nothing
 	 */
-	static void DisplayPeriodicData_task();
+	static void DisplayPeriodicData_task(void* context);
+
+	/*!
+	 * @brief Received data management task
+	 * @details This event task is activated by the USART Rx complete interrupt. It reads all the characters waiting in the reception buffer.
+	 * 			For each character, if debug mode is started, it calls debug mode management function. Otherwise it starts debug mode if the received character is 'a',
+	 * 			after stopping the telemetry stream if it is active.
+	 * 			The data are displayed once after all the characters have been processed.
+	 * @param [in] context Pointer to the debug interface object
+	 * @return Nothing
+	 */
+	static void DebugRxManagement_task(void* context);
+
+	static TaskHandle_t rx_task_handle; /*!< Handle of the received data management task, activated by USART interrupt */
 
 	/*!
 	 * @brief Displays data on usart link
@@ -79,12 +97,16 @@ public:
 	 *  @details This function manages the debug menu according to the following state machine :
 	 *  		 	  - MAIN_MENU state : handles user choice in main menu and selects next state\n
 	 *				  - WDG_MENU state : handles user choice in watchdog menu and selects next state\n
+	 *				  - PROFILER_MENU state : handles user choice in task profiler menu and selects next state\n
+	 *				  - TELEMETRY_MENU state : handles user choice in telemetry menu and selects next state\n
+	 *				  - BAUDRATE_MENU state : handles user choice in baud rate menu and goes back to main menu\n
 	 *
-	 *  		 It is called each time a data is received on USART and debug mode is active.
+	 *  		 It is called by the received data management task for each character received on USART when debug mode is active.
 	 *
+	 *  @param [in] rcv_char Received character
 	 *  @return True if the debug mode shall be closed, false otherwise
 	 */
-	bool DebugModeManagement();
+	bool DebugModeManagement(uint8_t rcv_char);
 
 	/*!
 	 * @brief Interface pointer get function
@@ -100,9 +122,9 @@ public:
 	/*!
 	 * @brief Menu string get function
 	 * @details This function returns the pointer to the menu string to display
-	 * @return Menu string pointer
+	 * @return Menu string pointer, in flash memory
 	 */
-	inline uint8_t* getMenuStringPtr()
+	inline const FlashString* getMenuStringPtr()
 	{
 		return menu_string_ptr;
 	}
@@ -132,10 +154,12 @@ private:
 
 	DebugInterface* debug_ift_ptr; /*!< Pointer to the debug interface object, which is used to send data on usart link */
 	SensorManagement* sensorMgt_ptr; /*!< Pointer to the sensor management object */
-	uint8_t* menu_string_ptr; /*!< Pointer to the current menu string to display */
+	const FlashString* menu_string_ptr; /*!< Pointer to the current menu string to display, stored in flash memory */
 	String* info_string_ptr; /*!< Pointer to the info message to display */
+	StaticString<DEBUG_MGT_INFO_STRING_SIZE> info_string; /*!< Info message written by the menus */
 	debug_mgt_state_struct_t debug_state; /*!< Structure containing debug states for each menu */
 	bool isInfoStringDisplayed; /*!< Value defining if the info string has been already displayed one complete cycle of not */
+	TaskHandle_t display_task_handle; /*!< Handle of the periodic display task */
 
 
 	/*!
@@ -164,6 +188,69 @@ private:
 	 */
 	void WatchdogMenuManagement(uint8_t rcv_char);
 
+	/*!
+	 * @brief Task profiler menu management function
+	 * @details This function manages the task profiler menu. It handles the character received on USART bus and execute the requested action.
+	 *
+	 * @param [in] rcv_char Character received on USART bus.
+	 * @return Nothing.
+	 */
+	void ProfilerMenuManagement(uint8_t rcv_char);
+
+	/*!
+	 * @brief Telemetry menu management function
+	 * @details This function manages the binary telemetry menu. It handles the character received on USART bus and execute the requested action.
+	 * 			When the stream is started, the debug mode is exited to leave the USART link to the binary frames.
+	 *
+	 * @param [in] rcv_char Character received on USART bus.
+	 * @return True if the debug mode shall be exited, false otherwise.
+	 */
+	bool TelemetryMenuManagement(uint8_t rcv_char);
+
+	/*!
+	 * @brief Baud rate menu management function
+	 * @details This function manages the baud rate selection menu. It handles the character received on USART bus and updates the baud rate of the link.
+	 * 			The menu is displayed again with the new baud rate, the terminal shall be configured accordingly.
+	 *
+	 * @param [in] rcv_char Character received on USART bus.
+	 * @return Nothing.
+	 */
+	void BaudRateMenuManagement(uint8_t rcv_char);
+
+	/*!
+	 * @brief Telemetry start function
+	 * @details This function prepares the start of the telemetry stream. It writes a message on the screen, removes the periodic task from the scheduler and starts the stream.
+	 *
+	 * @return Nothing.
+	 */
+	void startTelemetry();
+
+	/*!
+	 * @brief Decimation info message function
+	 * @details This function writes the current decimation factor of the telemetry stream in the info string.
+	 *
+	 * @return Nothing.
+	 */
+	void setDecimationInfoMessage();
+
+	/*!
+	 * @brief Task profiles display function
+	 * @details This function displays the execution time statistics of each task managed by the scheduler : number of invocations, minimum, average, maximum and worst case execution times.
+	 * 			The missed deadlines are also displayed with the worst lateness and the PIT of the last miss, followed by the estimated worst case load of a PIT.
+	 *
+	 * @return Nothing.
+	 */
+	void DisplayTaskProfiles();
+
+	/*!
+	 * @brief Duration display function
+	 * @details This function displays the given duration in microseconds, or in milliseconds if the duration is greater than 10 ms.
+	 *
+	 * @param [in] ticks Duration to display (scheduler timer ticks)
+	 * @return Nothing.
+	 */
+	void sendDuration(uint32_t ticks);
+
 	/*!
 	 * @brief Main menu management
 	 * @details This function manages the main debug menu. It handles the character received on USART bus and execute the requested action.
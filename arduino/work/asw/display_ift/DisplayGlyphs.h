@@ -0,0 +1,42 @@
+/*!
+ * @file DisplayGlyphs.h
+ *
+ * @brief Custom glyphs definition file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#ifndef WORK_ASW_DISPLAY_IFT_DISPLAYGLYPHS_H_
+#define WORK_ASW_DISPLAY_IFT_DISPLAYGLYPHS_H_
+
+/*!
+ * @brief Custom glyphs enumeration
+ * @details This enumeration defines the glyphs which can be displayed in addition to the character generator ROM.
+ * 			The glyphs are loaded in the screen CGRAM by the display interface when they are displayed.
+ */
+typedef enum
+{
+	DISPLAY_GLYPH_DEGREE = 0, /*!< Degree sign */
+	DISPLAY_GLYPH_ARROW_UP, /*!< Upward trend arrow */
+	DISPLAY_GLYPH_ARROW_DOWN, /*!< Downward trend arrow */
+	DISPLAY_GLYPH_VBAR_1, /*!< Vertical bar, 1 row high */
+	DISPLAY_GLYPH_VBAR_2, /*!< Vertical bar, 2 rows high */
+	DISPLAY_GLYPH_VBAR_3, /*!< Vertical bar, 3 rows high */
+	DISPLAY_GLYPH_VBAR_4, /*!< Vertical bar, 4 rows high */
+	DISPLAY_GLYPH_VBAR_5, /*!< Vertical bar, 5 rows high */
+	DISPLAY_GLYPH_VBAR_6, /*!< Vertical bar, 6 rows high */
+	DISPLAY_GLYPH_VBAR_7, /*!< Vertical bar, 7 rows high */
+	DISPLAY_GLYPH_HBAR_1, /*!< Horizontal bar, 1 column wide */
+	DISPLAY_GLYPH_HBAR_2, /*!< Horizontal bar, 2 columns wide */
+	DISPLAY_GLYPH_HBAR_3, /*!< Horizontal bar, 3 columns wide */
+	DISPLAY_GLYPH_HBAR_4, /*!< Horizontal bar, 4 columns wide */
+	DISPLAY_GLYPH_NB /*!< Number of glyphs */
+}
+T_DisplayInterface_Glyph;
+
+#define DISPLAY_GLYPH_CODE_BASE 0x10 /*!< Character codes 0x10 to 0x1F are not defined in the character generator ROM, they are used in the strings to identify the glyphs */
+#define DISPLAY_GLYPH_CODE(glyph) (DISPLAY_GLYPH_CODE_BASE + (glyph)) /*!< Character code of a glyph in the strings to display */
+#define DISPLAY_IS_GLYPH_CODE(c) (((c) >= DISPLAY_GLYPH_CODE_BASE) && ((c) < DISPLAY_GLYPH_CODE_BASE + DISPLAY_GLYPH_NB)) /*!< Checks if a character of a string to display is a glyph */
+
+#endif /* WORK_ASW_DISPLAY_IFT_DISPLAYGLYPHS_H_ */
@@ -12,21 +12,44 @@
 #include <util/delay.h>
 
 #include "../../lib/String/String.h"
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 
 #include "../../scheduler/scheduler.h"
 
 #include "../../bsw/I2C/I2C.h"
 #include "../../bsw/lcd/LCD.h"
 
+#include "DisplayGlyphs.h"
 #include "DisplayInterface.h"
 
 
 DisplayInterface* p_global_ASW_DisplayInterface;
 
+/*!
+ * @brief Glyphs table
+ * @details This table contains the definition of the glyphs, in the order of the enumeration T_DisplayInterface_Glyph.
+ */
+const T_Display_glyph DisplayInterface_Glyph_table[DISPLAY_GLYPH_NB] =
+{
+		{ {0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00}, 'o' }, /* Degree */
+		{ {0x04, 0x0E, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00}, '^' }, /* Arrow up */
+		{ {0x04, 0x04, 0x04, 0x04, 0x15, 0x0E, 0x04, 0x00}, 'v' }, /* Arrow down */
+		{ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}, '_' }, /* Vertical bar 1 */
+		{ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F}, '_' }, /* Vertical bar 2 */
+		{ {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}, '_' }, /* Vertical bar 3 */
+		{ {0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F}, '=' }, /* Vertical bar 4 */
+		{ {0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, '=' }, /* Vertical bar 5 */
+		{ {0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, '#' }, /* Vertical bar 6 */
+		{ {0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, '#' }, /* Vertical bar 7 */
+		{ {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10}, '-' }, /* Horizontal bar 1 */
+		{ {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18}, '-' }, /* Horizontal bar 2 */
+		{ {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C}, '=' }, /* Horizontal bar 3 */
+		{ {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}, '=' }  /* Horizontal bar 4 */
+};
+
 DisplayInterface::DisplayInterface(const T_LCD_conf_struct * LCD_init_cnf)
 {
-	uint8_t i;
+	uint8_t i, j;
 
 	dummy = 0;
 
@@ -43,16 +66,35 @@ DisplayInterface::DisplayInterface(const T_LCD_conf_struct * LCD_init_cnf)
 		display_data[i].mode = NORMAL;
 		display_data[i].isEmpty = true;
 		display_data[i].alignment = LEFT;
+		display_data[i].isDirty = false;
 
 		ClearStringInDataStruct(i);
 
-		display_data[i].shift_data.str_cur_ptr = 0;
-		display_data[i].shift_data.str_ptr = 0;
+		/* The screen has been cleared by the LCD driver initialization */
+		for(j = 0; j < LCD_SIZE_NB_CHAR_PER_LINE; j++)
+			lcd_shadow[i][j] = ' ';
+
+		display_data[i].shift_data.size = 0;
+		display_data[i].shift_data.offset = 0;
 		display_data[i].shift_data.temporization = 0;
 
 	}
 
+	/* Line shift task is created once, it is only resumed when a shift is in progress */
 	isShiftInProgress = false;
+	shift_task_handle = p_global_scheduler->addPeriodicTask(&DisplayInterface::shiftLine_task, DISPLAY_LINE_SHIFT_PERIOD_MS, TASK_PRIO_LOW, this);
+	p_global_scheduler->suspendTask(shift_task_handle);
+
+	/* CGRAM slots are loaded when a glyph is displayed, free slots are the oldest ones */
+	for(i = 0; i < LCD_CGRAM_SLOT_NB; i++)
+	{
+		glyph_slot_id[i] = DISPLAY_GLYPH_NO_SLOT;
+		glyph_slot_age[i] = 0xFF;
+	}
+
+	/* The screen is updated in background by the flush task, the display functions only update the data structure */
+	flush_line = 0;
+	p_global_scheduler->addPeriodicTask(&DisplayInterface::flushDisplay_task, DISPLAY_FLUSH_PERIOD_MS, TASK_PRIO_LOW, this);
 
 }
 
@@ -77,24 +119,28 @@ bool DisplayInterface::DisplayFullLine(uint8_t* str, uint8_t size, uint8_t line,
 		mode = LINE_SHIFT;
 
 
+	/* The string to shift is cut if it does not fit in the shift buffer */
+	if((mode == LINE_SHIFT) && (size > DISPLAY_LINE_SHIFT_MAX_SIZE))
+		size = DISPLAY_LINE_SHIFT_MAX_SIZE;
+
 	/* If the requested mode is LINE SHIFT and the line is already in LINE SHIFT mode,
-	 * do not execute the function completely : only the string in shift data structure shall be updated */
+	 * do not execute the function completely : only the string in shift data structure and the displayed window shall be updated */
 	if((mode == LINE_SHIFT) && (display_data[line].mode == LINE_SHIFT))
 	{
-		display_data[line].shift_data.str_ptr->Clear();
-		display_data[line].shift_data.str_ptr->appendString(str);
+		setShiftText(line, str, size);
 
-		/* The address of the string may have changed, replace pointer inside the range */
-		if(display_data[line].shift_data.str_cur_ptr > (display_data[line].shift_data.str_ptr->getString() + display_data[line].shift_data.str_ptr->getSize() - LCD_SIZE_NB_CHAR_PER_LINE))
-			display_data[line].shift_data.str_cur_ptr = display_data[line].shift_data.str_ptr->getString() + display_data[line].shift_data.str_ptr->getSize() - LCD_SIZE_NB_CHAR_PER_LINE;
-		else if (display_data[line].shift_data.str_cur_ptr < display_data[line].shift_data.str_ptr->getString())
-			display_data[line].shift_data.str_cur_ptr = display_data[line].shift_data.str_ptr->getString();
+		/* The size of the string may have changed, replace the window inside the range */
+		if(display_data[line].shift_data.offset > size - LCD_SIZE_NB_CHAR_PER_LINE)
+			display_data[line].shift_data.offset = size - LCD_SIZE_NB_CHAR_PER_LINE;
+
+		updateLineAndRefresh(&display_data[line].shift_data.text[display_data[line].shift_data.offset], LCD_SIZE_NB_CHAR_PER_LINE, line);
 
 		return true;
 	}
 
-	/* Clear the line to avoid issues in case a line shift is in progress on this line */
-	ClearLine(line);
+	/* Clear the line to avoid issues in case a line shift is in progress on this line
+	 * The display is not refreshed here, it is done once the new string is written */
+	ClearLine(line, false);
 
 	/* Update data */
 	display_data[line].mode = mode;
@@ -115,14 +161,14 @@ bool DisplayInterface::DisplayFullLine(uint8_t* str, uint8_t size, uint8_t line,
 		updateLineAndRefresh(str, LCD_SIZE_NB_CHAR_PER_LINE, line);
 
 		/* Update shift data structure */
-		display_data[line].shift_data.str_ptr = new String((const uint8_t*)str);
-		display_data[line].shift_data.str_cur_ptr = display_data[line].shift_data.str_ptr->getString();
+		setShiftText(line, str, size);
+		display_data[line].shift_data.offset = 0;
 		display_data[line].shift_data.temporization = DISPLAY_LINE_SHIFT_TEMPO_TIME;
 
-		/* If no shift is in progress on another line, add periodic task to scheduler */
+		/* If no shift is in progress on another line, resume periodic task */
 		if(isShiftInProgress == false)
 		{
-			p_global_scheduler->addPeriodicTask((TaskPtr_t)(&DisplayInterface::shiftLine_task), DISPLAY_LINE_SHIFT_PERIOD_MS);
+			p_global_scheduler->resumeTask(shift_task_handle);
 			isShiftInProgress = true;
 		}
 
@@ -161,17 +207,313 @@ void DisplayInterface::updateLineAndRefresh(uint8_t* str, uint8_t size, uint8_t
 	RefreshLine(line);
 }
 
-void DisplayInterface::RefreshLine(uint8_t line)
+void DisplayInterface::flushDisplay_task(void* context)
 {
+	((DisplayInterface*)context)->flushDisplay();
+}
+
+void DisplayInterface::flushDisplay()
+{
+	uint8_t budget = DISPLAY_FLUSH_CHAR_BUDGET;
 	uint8_t i;
 
-	/* Find DDRAM address of the start of the requested line */
-	p_lcd->SetDDRAMAddress(FindFirstCharAddr(line));
+	/* Nothing is written while the screen is initializing or clearing, the lines stay marked as updated */
+	if(!p_lcd->IsReady())
+		return;
 
-	/* Write each character on the screen */
-	for (i=0; i<LCD_SIZE_NB_CHAR_PER_LINE; i++)
-		p_lcd->WriteInRam(display_data[line].display_str[i], LCD_DATA_DDRAM);
+	/* The content of the screen is unknown after a failed transmission */
+	if(p_lcd->ReadTxError())
+		invalidateScreen();
+
+	/* Start with the line following the last one flushed, to avoid that a line often updated delays the other ones */
+	for(i = 0; (i < LCD_SIZE_NB_LINES) && (budget > 0) && p_lcd->IsTxBufferAvailable(); i++)
+	{
+		if(display_data[flush_line].isDirty)
+			flushLine(flush_line, &budget);
+
+		/* Stay on the same line if it has not been written entirely */
+		if(!display_data[flush_line].isDirty)
+			flush_line = (flush_line + 1) % LCD_SIZE_NB_LINES;
+	}
+}
+
+void DisplayInterface::flushLine(uint8_t line, uint8_t* budget)
+{
+	uint8_t* shadow = lcd_shadow[line];
+	uint8_t frame[LCD_SIZE_NB_CHAR_PER_LINE];
+	uint8_t i, j, run_start, run_end, gap, code;
+	uint8_t used_slots = 0;
+
+	/* The flag is cleared before the comparison : if the line is updated during the flush, it will be processed again */
+	display_data[line].isDirty = false;
+
+	/* The CGRAM slots displayed on the screen shall not be replaced */
+	for(j = 0; j < LCD_SIZE_NB_LINES; j++)
+	{
+		for(i = 0; i < LCD_SIZE_NB_CHAR_PER_LINE; i++)
+		{
+			code = lcd_shadow[j][i];
+			if((code >= LCD_CGRAM_CHAR_CODE(0)) && (code < LCD_CGRAM_CHAR_CODE(LCD_CGRAM_SLOT_NB)))
+				used_slots |= (1 << (code - LCD_CGRAM_CHAR_CODE(0)));
+		}
+	}
+
+	/* Build the characters to send : the glyphs are replaced by the code of their CGRAM slot.
+	 * The string is copied as it may be updated by a higher priority task during the flush */
+	for(i = 0; i < LCD_SIZE_NB_CHAR_PER_LINE; i++)
+	{
+		code = display_data[line].display_str[i];
+
+		if(DISPLAY_IS_GLYPH_CODE(code))
+		{
+			code = getGlyphCode(code - DISPLAY_GLYPH_CODE_BASE, used_slots, budget);
+
+			/* The glyph can not be loaded during this flush, the character is kept and will be written at next flush */
+			if(code == 0)
+			{
+				code = shadow[i];
+				display_data[line].isDirty = true;
+			}
+			else if((code >= LCD_CGRAM_CHAR_CODE(0)) && (code < LCD_CGRAM_CHAR_CODE(LCD_CGRAM_SLOT_NB)))
+				used_slots |= (1 << (code - LCD_CGRAM_CHAR_CODE(0)));
+		}
+
+		frame[i] = code;
+	}
+
+	i = 0;
+	while(i < LCD_SIZE_NB_CHAR_PER_LINE)
+	{
+		/* Skip the characters already displayed */
+		if(frame[i] == shadow[i])
+		{
+			i++;
+			continue;
+		}
+
+		/* The address setting and at least one character shall fit in the budget, else the end of the line is written at next flush.
+		 * The flush also ends when no LCD string buffer is free, instead of waiting for the end of the I2C transmissions */
+		if((*budget < 2) || !p_lcd->IsTxBufferAvailable())
+		{
+			display_data[line].isDirty = true;
+			return;
+		}
+
+		/* Find the end of the run of changed characters, small gaps of unchanged characters are included in the run */
+		run_start = i;
+		run_end = i + 1;
+		gap = 0;
+		for(i = run_start + 1; (i < LCD_SIZE_NB_CHAR_PER_LINE) && (gap <= DISPLAY_REFRESH_MAX_GAP); i++)
+		{
+			if(frame[i] != shadow[i])
+			{
+				run_end = i + 1;
+				gap = 0;
+			}
+			else
+				gap++;
+		}
+
+		/* Cut the run to the remaining budget */
+		if(run_end - run_start > *budget - 1)
+			run_end = run_start + *budget - 1;
+
+		*budget -= run_end - run_start + 1;
+
+		for(i = run_start; i < run_end; i++)
+			shadow[i] = frame[i];
+
+		/* Write the run on the screen in a single transmission, starting with its DDRAM address.
+		 * If it can not be sent, the run is invalidated to be written again at next flush */
+		if(!p_lcd->WriteStringAt(FindFirstCharAddr(line) + run_start, &shadow[run_start], run_end - run_start))
+		{
+			for(i = run_start; i < run_end; i++)
+				shadow[i] = DISPLAY_SHADOW_INVALID_CHAR;
+
+			display_data[line].isDirty = true;
+			return;
+		}
+	}
+}
+
+void DisplayInterface::invalidateScreen()
+{
+	uint8_t i, j;
+
+	for(i = 0; i < LCD_SIZE_NB_LINES; i++)
+	{
+		for(j = 0; j < LCD_SIZE_NB_CHAR_PER_LINE; j++)
+			lcd_shadow[i][j] = DISPLAY_SHADOW_INVALID_CHAR;
+
+		display_data[i].isDirty = true;
+	}
+
+	/* A failed glyph loading leaves the slot content unknown */
+	for(i = 0; i < LCD_CGRAM_SLOT_NB; i++)
+	{
+		glyph_slot_id[i] = DISPLAY_GLYPH_NO_SLOT;
+		glyph_slot_age[i] = 0xFF;
+	}
+}
+
+uint8_t DisplayInterface::getGlyphCode(uint8_t glyph, uint8_t used_slots, uint8_t* budget)
+{
+	uint8_t slot, i;
+	uint8_t lru_slot = DISPLAY_GLYPH_NO_SLOT;
+
+	/* Look for the glyph in CGRAM and memorize the least recently used slot which is not displayed, in case of miss */
+	for(slot = 0; slot < LCD_CGRAM_SLOT_NB; slot++)
+	{
+		if(glyph_slot_id[slot] == glyph)
+			break;
+
+		if(((used_slots & (1 << slot)) == 0)
+				&& ((lru_slot == DISPLAY_GLYPH_NO_SLOT) || (glyph_slot_age[slot] > glyph_slot_age[lru_slot])))
+			lru_slot = slot;
+	}
+
+	/* The glyph is not loaded : replace the least recently used slot */
+	if(slot >= LCD_CGRAM_SLOT_NB)
+	{
+		if(lru_slot == DISPLAY_GLYPH_NO_SLOT)
+			return DisplayInterface_Glyph_table[glyph].fallback_char;
+
+		if((*budget < DISPLAY_GLYPH_UPLOAD_COST) || !p_lcd->IsTxBufferAvailable())
+			return 0;
 
+		*budget -= DISPLAY_GLYPH_UPLOAD_COST;
+
+		slot = lru_slot;
+
+		/* If the glyph can not be sent, the slot content is unknown */
+		if(!p_lcd->WriteGlyph(slot, DisplayInterface_Glyph_table[glyph].bitmap))
+		{
+			glyph_slot_id[slot] = DISPLAY_GLYPH_NO_SLOT;
+			glyph_slot_age[slot] = 0xFF;
+			return 0;
+		}
+
+		glyph_slot_id[slot] = glyph;
+	}
+
+	/* Update ages, the age of the free slots stays at maximum value */
+	for(i = 0; i < LCD_CGRAM_SLOT_NB; i++)
+	{
+		if((glyph_slot_id[i] != DISPLAY_GLYPH_NO_SLOT) && (glyph_slot_age[i] < 0xFE))
+			glyph_slot_age[i]++;
+	}
+	glyph_slot_age[slot] = 0;
+
+	return LCD_CGRAM_CHAR_CODE(slot);
+}
+
+bool DisplayInterface::prepareWidgetLine(uint8_t line, uint8_t column, uint8_t width)
+{
+	if((line >= LCD_SIZE_NB_LINES) || (width == 0) || (column + width > LCD_SIZE_NB_CHAR_PER_LINE))
+		return false;
+
+	/* A widget can only be displayed on a line in normal mode */
+	if(display_data[line].mode != NORMAL)
+		ClearLine(line, false);
+
+	display_data[line].isEmpty = false;
+
+	return true;
+}
+
+bool DisplayInterface::DisplaySparkline(uint8_t line, uint8_t column, int16_t* values, uint8_t nb_values, int16_t min, int16_t max)
+{
+	uint8_t i, level;
+	uint8_t* str;
+
+	if((max <= min) || !prepareWidgetLine(line, column, nb_values))
+		return false;
+
+	str = &(display_data[line].display_str[column]);
+
+	for(i = 0; i < nb_values; i++)
+	{
+		/* Compute the height of the bar */
+		if(values[i] <= min)
+			level = 0;
+		else if(values[i] >= max)
+			level = DISPLAY_SPARKLINE_LEVEL_NB;
+		else
+			level = (uint8_t)((((int32_t)values[i] - min) * DISPLAY_SPARKLINE_LEVEL_NB) / ((int32_t)max - min));
+
+		/* Empty and full characters are available in ROM */
+		if(level == 0)
+			str[i] = ' ';
+		else if(level >= DISPLAY_SPARKLINE_LEVEL_NB)
+			str[i] = LCD_CHAR_FULL_BLOCK;
+		else
+			str[i] = DISPLAY_GLYPH_CODE(DISPLAY_GLYPH_VBAR_1 + level - 1);
+	}
+
+	RefreshLine(line);
+
+	return true;
+}
+
+bool DisplayInterface::DisplayBarGraph(uint8_t line, uint8_t column, uint8_t width, uint16_t value, uint16_t max)
+{
+	uint8_t i;
+	uint16_t columns;
+	uint8_t* str;
+
+	if((max == 0) || !prepareWidgetLine(line, column, width))
+		return false;
+
+	str = &(display_data[line].display_str[column]);
+
+	if(value > max)
+		value = max;
+
+	/* Number of dot columns to fill */
+	columns = (uint16_t)(((uint32_t)value * width * DISPLAY_BARGRAPH_COLUMNS_PER_CHAR) / max);
+
+	for(i = 0; i < width; i++)
+	{
+		if(columns >= DISPLAY_BARGRAPH_COLUMNS_PER_CHAR)
+		{
+			str[i] = LCD_CHAR_FULL_BLOCK;
+			columns -= DISPLAY_BARGRAPH_COLUMNS_PER_CHAR;
+		}
+		else if(columns > 0)
+		{
+			str[i] = DISPLAY_GLYPH_CODE(DISPLAY_GLYPH_HBAR_1 + columns - 1);
+			columns = 0;
+		}
+		else
+			str[i] = ' ';
+	}
+
+	RefreshLine(line);
+
+	return true;
+}
+
+bool DisplayInterface::DisplayText(uint8_t* str, uint8_t size, uint8_t line, uint8_t column, uint8_t width)
+{
+	uint8_t i;
+	uint8_t* line_str;
+
+	if(!prepareWidgetLine(line, column, width))
+		return false;
+
+	line_str = &(display_data[line].display_str[column]);
+
+	for(i = 0; i < width; i++)
+	{
+		if(i < size)
+			line_str[i] = str[i];
+		else
+			line_str[i] = ' ';
+	}
+
+	RefreshLine(line);
+
+	return true;
 }
 
 void DisplayInterface::ClearStringInDataStruct(uint8_t line)
@@ -222,6 +564,11 @@ uint8_t DisplayInterface::FindFirstCharAddr(uint8_t line)
 }
 
 bool DisplayInterface::ClearLine(uint8_t line)
+{
+	return ClearLine(line, true);
+}
+
+bool DisplayInterface::ClearLine(uint8_t line, bool isRefreshNeeded)
 {
 	uint8_t i;
 	bool dummy, isNextLineMode = false;
@@ -233,14 +580,10 @@ bool DisplayInterface::ClearLine(uint8_t line)
 	if(display_data[line].mode == GO_TO_NEXT_LINE)
 		isNextLineMode = true;
 
-	/* Free shift data string */
-	if(display_data[line].mode == LINE_SHIFT)
-		free(display_data[line].shift_data.str_ptr);
-
 	/* Set line mode to NORMAL */
 	display_data[line].mode = NORMAL;
 
-	/* Check if there is still some lines to shift, if no, remove the periodic task */
+	/* Check if there is still some lines to shift, if no, suspend the periodic task */
 	isShiftInProgress = false;
 
 	for(i=0; i<LCD_SIZE_NB_LINES; i++)
@@ -250,14 +593,15 @@ bool DisplayInterface::ClearLine(uint8_t line)
 	}
 
 	if(isShiftInProgress == false)
-		dummy = p_global_scheduler->removePeriodicTask((TaskPtr_t)(&DisplayInterface::shiftLine_task));
+		dummy = p_global_scheduler->suspendTask(shift_task_handle);
 
 	/* Mark line as empty */
 	display_data[line].isEmpty = true;
 
-	/* Clear string in data structure and refresh display */
+	/* Clear string in data structure and refresh display if needed */
 	ClearStringInDataStruct(line);
-	RefreshLine(line);
+	if(isRefreshNeeded)
+		RefreshLine(line);
 
 	/* If the line was in next line mode, clear also the next line */
 	if(isNextLineMode)
@@ -283,9 +627,10 @@ bool DisplayInterface::IsLineEmpty(uint8_t line)
 	return display_data[line].isEmpty;
 }
 
-void DisplayInterface::shiftLine_task()
+void DisplayInterface::shiftLine_task(void* context)
 {
-	T_display_data* display_data_ptr = p_global_ASW_DisplayInterface->getDisplayDataPtr();
+	DisplayInterface* ift_ptr = (DisplayInterface*)context;
+	T_display_data* display_data_ptr = ift_ptr->getDisplayDataPtr();
 	T_Display_shift_data* display_shift_data_ptr;
 	uint8_t i;
 
@@ -298,38 +643,48 @@ void DisplayInterface::shiftLine_task()
 			/* Update shift data pointer */
 			display_shift_data_ptr = &(display_data_ptr[i].shift_data);
 
-			/* Increment pointer and if we are at the end of the line, go back at the beginning */
-			if (display_shift_data_ptr->str_cur_ptr >= (display_shift_data_ptr->str_ptr->getString() + display_shift_data_ptr->str_ptr->getSize() - LCD_SIZE_NB_CHAR_PER_LINE))
+			/* Increment offset and if we are at the end of the line, go back at the beginning */
+			if (display_shift_data_ptr->offset >= (display_shift_data_ptr->size - LCD_SIZE_NB_CHAR_PER_LINE))
 			{
 				if(display_shift_data_ptr->temporization == 0)
 				{
-					display_shift_data_ptr->str_cur_ptr = display_shift_data_ptr->str_ptr->getString();
+					display_shift_data_ptr->offset = 0;
 					display_shift_data_ptr->temporization = DISPLAY_LINE_SHIFT_TEMPO_TIME;
 				}
 				else
 					display_shift_data_ptr->temporization--;
 			}
-			else if(display_shift_data_ptr->str_cur_ptr == display_shift_data_ptr->str_ptr->getString())
+			else if(display_shift_data_ptr->offset == 0)
 			{
 				if(display_shift_data_ptr->temporization == 0)
 				{
-					display_shift_data_ptr->str_cur_ptr ++;
+					display_shift_data_ptr->offset++;
 					display_shift_data_ptr->temporization = DISPLAY_LINE_SHIFT_TEMPO_TIME;
 				}
 				else
 					display_shift_data_ptr->temporization--;
 			}
 			else
-				display_shift_data_ptr->str_cur_ptr ++;
+				display_shift_data_ptr->offset++;
 
 			/* Display the line */
-			p_global_ASW_DisplayInterface->updateLineAndRefresh(display_shift_data_ptr->str_cur_ptr, LCD_SIZE_NB_CHAR_PER_LINE, i);
+			ift_ptr->updateLineAndRefresh(&(display_shift_data_ptr->text[display_shift_data_ptr->offset]), LCD_SIZE_NB_CHAR_PER_LINE, i);
 		}
 
 	}
 
 }
 
+void DisplayInterface::setShiftText(uint8_t line, uint8_t* str, uint8_t size)
+{
+	uint8_t i;
+
+	for(i = 0; i < size; i++)
+		display_data[line].shift_data.text[i] = str[i];
+
+	display_data[line].shift_data.size = size;
+}
+
 
 void DisplayInterface::setLineAlignment(uint8_t line)
 {
@@ -38,14 +38,18 @@ typedef enum
 }
 T_DisplayInterface_LineAlignment;
 
+#define DISPLAY_LINE_SHIFT_MAX_SIZE 48 /*!< Maximum number of characters of a string displayed in "line shift" mode, the end of longer strings is cut */
+
 /*!
  * @brief Structure containing shift data
  * @details This structure contains all useful data for line shifting. These data need to be kept between each call of the periodic function.
+ * 			The whole string is stored in a fixed buffer, the displayed window is defined by its offset in the buffer.
  */
 typedef struct
 {
-	String* str_ptr; /*!< Pointer to the start address of the string */
-	uint8_t* str_cur_ptr; /*!< Pointer to the address of the first displayed character */
+	uint8_t text[DISPLAY_LINE_SHIFT_MAX_SIZE]; /*!< Complete string to shift */
+	uint8_t size; /*!< Number of characters in the string */
+	uint8_t offset; /*!< Index of the first displayed character */
 	uint8_t temporization; /*!< Shifting period */
 }
 T_Display_shift_data;
@@ -61,12 +65,32 @@ typedef struct
 	T_DisplayInterface_LineAlignment alignment; /*!< Line alignment */
 	T_Display_shift_data shift_data; /*!< Shift data for the current line */
 	uint8_t display_str[LCD_SIZE_NB_CHAR_PER_LINE]; /*!< Current string displayed on the screen */
+	volatile bool isDirty; /*!< Flag indicating that the string has been updated and is not yet entirely written on the screen */
 }
 T_display_data;
 
 
 #define DISPLAY_LINE_SHIFT_PERIOD_MS 500 /*!< In "line shift" mode for line display, line is shifted every 500 ms */
 #define DISPLAY_LINE_SHIFT_TEMPO_TIME 6 /*!< In "line shift" mode for line display, a temporization of 6 periods is added at the end and the beginning of the lines */
+#define DISPLAY_FLUSH_PERIOD_MS 20 /*!< The updated characters are written on the screen every 20 ms */
+#define DISPLAY_FLUSH_CHAR_BUDGET 21 /*!< Maximum number of characters written on the screen at each flush, a DDRAM address setting counts as one character. 21 characters allow to write a full line with its address */
+#define DISPLAY_REFRESH_MAX_GAP 2 /*!< During a line refresh, two runs of changed characters separated by up to 2 unchanged characters are sent as a single run : it is cheaper than a new transaction */
+#define DISPLAY_GLYPH_UPLOAD_COST (LCD_CGRAM_GLYPH_SIZE + 2) /*!< Cost of a glyph loading in the flush budget : the bitmap rows and the two address settings */
+#define DISPLAY_GLYPH_NO_SLOT 0xFF /*!< Value of a CGRAM slot which contains no glyph */
+#define DISPLAY_SHADOW_INVALID_CHAR DISPLAY_GLYPH_CODE_BASE /*!< Value of a shadow character whose content on the screen is unknown : glyph codes are never sent to the screen, then the character is always written again */
+#define DISPLAY_SPARKLINE_LEVEL_NB 8 /*!< A sparkline character displays 9 levels : empty, 1 to 7 rows and full block */
+#define DISPLAY_BARGRAPH_COLUMNS_PER_CHAR 5 /*!< A bar graph character displays 6 levels : empty, 1 to 4 columns and full block */
+
+/*!
+ * @brief Structure defining a glyph
+ * @details This structure contains the bitmap loaded in CGRAM and the ROM character displayed if no CGRAM slot is available.
+ */
+typedef struct
+{
+	uint8_t bitmap[LCD_CGRAM_GLYPH_SIZE]; /*!< Rows of the glyph, from top to bottom */
+	uint8_t fallback_char; /*!< Character displayed instead of the glyph if it can not be loaded */
+}
+T_Display_glyph;
 
 
 /*!
@@ -110,6 +134,50 @@ public:
 	 */
 	bool DisplayFullLine(String* str, uint8_t line, T_DisplayInterface_LineDisplayMode mode = NORMAL, T_DisplayInterface_LineAlignment alignment = LEFT);
 
+	/*!
+	 * @brief Sparkline display function
+	 * @details This function displays a history of values as a sparkline : each value is displayed as a vertical bar in one character.
+	 * 			The height of the bar is the position of the value between min and max, on DISPLAY_SPARKLINE_LEVEL_NB levels.
+	 * 			The other characters of the line are kept, except if the line is shifted or continued on the next line : in this case it is cleared first.
+	 *
+	 * @param [in] line Index of the line where the sparkline shall be displayed
+	 * @param [in] column Index of the first character of the sparkline
+	 * @param [in] values Pointer to the values to display, from the oldest to the newest
+	 * @param [in] nb_values Number of values, one character per value
+	 * @param [in] min Value displayed as an empty character
+	 * @param [in] max Value displayed as a full block, shall be greater than min
+	 * @return True if the sparkline has been displayed, false if it does not fit on the line
+	 */
+	bool DisplaySparkline(uint8_t line, uint8_t column, int16_t* values, uint8_t nb_values, int16_t min, int16_t max);
+
+	/*!
+	 * @brief Bar graph display function
+	 * @details This function displays a value as a horizontal bar graph. Each character of the bar graph displays DISPLAY_BARGRAPH_COLUMNS_PER_CHAR columns.
+	 * 			The other characters of the line are kept, except if the line is shifted or continued on the next line : in this case it is cleared first.
+	 *
+	 * @param [in] line Index of the line where the bar graph shall be displayed
+	 * @param [in] column Index of the first character of the bar graph
+	 * @param [in] width Number of characters of the bar graph
+	 * @param [in] value Value to display, saturated to max
+	 * @param [in] max Value displayed as a full bar graph, shall not be 0
+	 * @return True if the bar graph has been displayed, false if it does not fit on the line
+	 */
+	bool DisplayBarGraph(uint8_t line, uint8_t column, uint8_t width, uint16_t value, uint16_t max);
+
+	/*!
+	 * @brief Text field display function
+	 * @details This function displays a string in a field of the requested line. The string is cut if it is longer than the field, else the end of the field is filled with spaces.
+	 * 			The other characters of the line are kept, except if the line is shifted or continued on the next line : in this case it is cleared first.
+	 *
+	 * @param [in] str Pointer to the string to display
+	 * @param [in] size Size of the string
+	 * @param [in] line Index of the line where the field is
+	 * @param [in] column Index of the first character of the field
+	 * @param [in] width Number of characters of the field
+	 * @return True if the field has been displayed, false if it does not fit on the line
+	 */
+	bool DisplayText(uint8_t* str, uint8_t size, uint8_t line, uint8_t column, uint8_t width);
+
 	/*!
 	 * @brief Line clearing function
 	 * @details This function clears the requested line. It sets the corresponding DDRAM addresses to the ASCII value of space character.
@@ -141,9 +209,20 @@ public:
 	 * @brief Line shifting periodic task
 	 * @details This function is called periodically by the scheduler. It shifts all the lines in line shifting mode and updates the data structures.
 	 *
+	 * @param [in] context Pointer to the display interface object
+	 * @return Nothing
+	 */
+	static void shiftLine_task(void* context);
+
+	/*!
+	 * @brief Display flush periodic task
+	 * @details This function is called periodically by the scheduler. It writes on the screen the characters updated in the display data structure,
+	 * 			within the limit of DISPLAY_FLUSH_CHAR_BUDGET characters. The lines are processed in a round-robin way, the remaining characters are written at the next call.
+	 *
+	 * @param [in] context Pointer to the display interface object
 	 * @return Nothing
 	 */
-	static void shiftLine_task();
+	static void flushDisplay_task(void* context);
 
 	/*!
 	 * @brief Display data get function
@@ -186,7 +265,12 @@ private:
 	LCD* p_lcd; /*!< Pointer to the attached LCD driver object */
 	uint32_t dummy; /*!< Needed for data alignment */
 	T_display_data display_data[LCD_SIZE_NB_LINES]; /*!< Screen display data */
+	uint8_t lcd_shadow[LCD_SIZE_NB_LINES][LCD_SIZE_NB_CHAR_PER_LINE]; /*!< Copy of the characters currently written in the screen DDRAM, used to send only the changed characters */
+	uint8_t flush_line; /*!< Line processed first by the next display flush */
 	bool isShiftInProgress; /*!< Flag indicating if a shift is in progress on any line */
+	TaskHandle_t shift_task_handle; /*!< Handle of the line shift task, which is suspended when no shift is in progress */
+	uint8_t glyph_slot_id[LCD_CGRAM_SLOT_NB]; /*!< Glyph loaded in each CGRAM slot, DISPLAY_GLYPH_NO_SLOT if the slot is free */
+	uint8_t glyph_slot_age[LCD_CGRAM_SLOT_NB]; /*!< Number of glyph uses since the last use of each CGRAM slot, used to find the least recently used slot */
 
 	/*!
 	 * @brief Finds start address of a line.
@@ -199,13 +283,37 @@ private:
 
 	/*!
 	 * @brief Line refresh function
-	 * @details This function refreshes the display on the requested line. It computes the screen RAM address and writes the string to display into the screen RAM.
+	 * @details This function requests the refresh of the display on the requested line. The line is only marked as updated, it is written on the screen by the display flush task.
 	 * 			It shall be called everytime the string in display data structure is updated.
 	 *
 	 * @param [in] line Line to refresh
 	 * @return Nothing
 	 */
-	void RefreshLine(uint8_t line);
+	inline void RefreshLine(uint8_t line)
+	{
+		display_data[line].isDirty = true;
+	}
+
+	/*!
+	 * @brief Line flush function
+	 * @details This function compares the string of the requested line to the copy of the screen DDRAM.
+	 * 			Only the runs of changed characters are written into the screen RAM, each of them in a single transmission with its start address.
+	 * 			The function stops when the budget is consumed, the line stays marked as updated in this case.
+	 * 			If a run can not be queued for transmission, it is invalidated in the copy of the screen DDRAM and will be written again.
+	 *
+	 * @param [in] line Line to flush
+	 * @param [in,out] budget Remaining number of characters which can be written, updated by the function
+	 * @return Nothing
+	 */
+	void flushLine(uint8_t line, uint8_t* budget);
+
+	/*!
+	 * @brief Display flush function
+	 * @details This function writes the updated lines on the screen, within the limit of DISPLAY_FLUSH_CHAR_BUDGET characters.
+	 *
+	 * @return Nothing
+	 */
+	void flushDisplay();
 
 	/*!
 	 * @brief String data clearing structure
@@ -216,6 +324,18 @@ private:
 	 */
 	void ClearStringInDataStruct(uint8_t line);
 
+	/*!
+	 * @brief Line cleaning function
+	 * @details This function clears the requested line in the data structure. The display is refreshed only if requested,
+	 * 			it allows to clear a line which is immediately rewritten without sending the intermediate blank line to the screen.
+	 * 			If the line was in next line mode, the next line is always cleared and refreshed.
+	 *
+	 * @param [in] line Line to clear
+	 * @param [in] isRefreshNeeded True if the display shall be refreshed
+	 * @return True if the line has been cleared, false otherwise
+	 */
+	bool ClearLine(uint8_t line, bool isRefreshNeeded);
+
 	/*!
 	 * @brief Text alignment setting function
 	 * @details This function updates the text alignment on the requested line.
@@ -226,6 +346,50 @@ private:
 	 */
 	void setLineAlignment(uint8_t line);
 
+	/*!
+	 * @brief Shift string setting function
+	 * @details This function copies the string to shift in the shift buffer of the requested line. The size shall not exceed DISPLAY_LINE_SHIFT_MAX_SIZE.
+	 *
+	 * @param [in] line Line to update
+	 * @param [in] str Pointer to the string to shift
+	 * @param [in] size Size of the string
+	 * @return Nothing
+	 */
+	void setShiftText(uint8_t line, uint8_t* str, uint8_t size);
+
+	/*!
+	 * @brief Glyph character code get function
+	 * @details This function returns the character code to send to the screen to display the requested glyph.
+	 * 			If the glyph is not loaded in CGRAM, it is loaded in a free slot or in the least recently used slot which is not displayed.
+	 * 			If all slots are displayed, the fallback character of the glyph is returned.
+	 *
+	 * @param [in] glyph Requested glyph
+	 * @param [in] used_slots Mask of the CGRAM slots displayed on the screen or in the line being flushed, they can not be replaced
+	 * @param [in,out] budget Remaining number of characters which can be written, decreased by DISPLAY_GLYPH_UPLOAD_COST if the glyph is loaded
+	 * @return Character code of the glyph, 0 if the glyph can not be loaded now
+	 */
+	uint8_t getGlyphCode(uint8_t glyph, uint8_t used_slots, uint8_t* budget);
+
+	/*!
+	 * @brief Screen content invalidation function
+	 * @details This function is called after a failed transmission to the screen : the copy of the screen DDRAM and the CGRAM slots are invalidated
+	 * 			and all the lines are marked as updated, then the whole screen is written again by the next flushes.
+	 *
+	 * @return Nothing
+	 */
+	void invalidateScreen();
+
+	/*!
+	 * @brief Widget line preparation function
+	 * @details This function checks that a widget fits on the requested line and switches the line to NORMAL mode if it is shifted or continued on the next line.
+	 *
+	 * @param [in] line Index of the line
+	 * @param [in] column Index of the first character of the widget
+	 * @param [in] width Number of characters of the widget
+	 * @return True if the widget can be displayed, false otherwise
+	 */
+	bool prepareWidgetLine(uint8_t line, uint8_t column, uint8_t width);
+
 
 };
 
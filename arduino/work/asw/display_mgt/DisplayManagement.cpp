@@ -9,8 +9,9 @@
 
 #include <stdlib.h>
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../lib/string/String.h"
 
 #include "../../scheduler/scheduler.h"
@@ -20,14 +21,15 @@
 
 #include "../sensors_mgt/SensorManagement.h"
 #include "../display_ift/DisplayInterface.h"
+#include "page_configuration.h"
 #include "DisplayManagement.h"
 
 #include "../time_mgt/TimeManagement.h"
 
 DisplayManagement* p_global_ASW_DisplayManagement;
 
-const uint8_t welcomeMessageString[] = "Bienvenue !"; /*!< String displayed on the screen at startup */
-const uint8_t noSensorsDisplayString[] = "Capteurs desactives"; /*!< String used in case sensors are deactivated */
+const uint8_t welcomeMessageString[] PROGMEM = "Bienvenue !"; /*!< String displayed on the screen at startup */
+const uint8_t noSensorsDisplayString[] PROGMEM = "Capteurs desactives"; /*!< String used in case sensors are deactivated */
 
 DisplayManagement::DisplayManagement()
 {
@@ -43,57 +45,192 @@ DisplayManagement::DisplayManagement()
 	else
 		p_SensorMgt = 0;
 
+	/* First page is displayed entirely after the welcome message */
+	current_page = 0;
+	isPageRedrawNeeded = true;
+	isWelcomeDisplayed = true;
+	pending_timer = 0;
+	pending_delay = 0;
+
 	/* Display welcome message on 2nd line */
-	p_display_ift->DisplayFullLine((uint8_t*)welcomeMessageString, sizeof(welcomeMessageString)/sizeof(uint8_t) - 1, 1, NORMAL, CENTER);
+	StaticString<LCD_SIZE_NB_CHAR_PER_LINE> str;
+	str.appendString(FLASH_STRING(welcomeMessageString));
+	p_display_ift->DisplayFullLine(&str, 1, NORMAL, CENTER);
 
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)&DisplayManagement::RemoveWelcomeMessage_Task, DISPLAY_MGT_PERIOD_WELCOME_MSG_REMOVAL);
+	/* Add periodic task in scheduler, the page is not displayed until the welcome message is removed */
+	p_global_scheduler->addPeriodicTask(&DisplayManagement::DisplayPage_Task, DISPLAY_MGT_PERIOD_TASK_PAGE, TASK_PRIO_LOW, this);
 
-	/* Update temperature and humidity sensor task period to match display period */
-	/* TODO : check how to manage display period synchro */
+	startTimer(&DisplayManagement::RemoveWelcomeMessage_Task, DISPLAY_MGT_PERIOD_WELCOME_MSG_REMOVAL);
 
 }
 
-void DisplayManagement::RemoveWelcomeMessage_Task()
+void DisplayManagement::RemoveWelcomeMessage_Task(void* arg)
 {
-	DisplayInterface * ift_ptr = p_global_ASW_DisplayManagement->GetIftPointer();
+	DisplayManagement* display_mgt_ptr = (DisplayManagement*)arg;
+
+	display_mgt_ptr->isWelcomeDisplayed = false;
+
+	/* Start pages rotation */
+	display_mgt_ptr->startTimer(&DisplayManagement::NextPage_Task, pgm_read_word(&DisplayManagement_Page_list[display_mgt_ptr->current_page].duration));
+
+	/* Display page manually to avoid a blank screen until the task is called by the scheduler */
+	display_mgt_ptr->DisplayPage();
+}
+
+void DisplayManagement::NextPage_Task(void* arg)
+{
+	DisplayManagement* display_mgt_ptr = (DisplayManagement*)arg;
+
+	display_mgt_ptr->current_page = (display_mgt_ptr->current_page + 1) % DISPLAY_MGT_PAGE_NB;
+	display_mgt_ptr->isPageRedrawNeeded = true;
+
+	display_mgt_ptr->startTimer(&DisplayManagement::NextPage_Task, pgm_read_word(&DisplayManagement_Page_list[display_mgt_ptr->current_page].duration));
+
+	display_mgt_ptr->DisplayPage();
+}
 
-	/* Remove itself from scheduler */
-	p_global_scheduler->removePeriodicTask((TaskPtr_t)&DisplayManagement::RemoveWelcomeMessage_Task);
+void DisplayManagement::startTimer(OneShotPtr_t fct_ptr, uint16_t delay_ms)
+{
+	/* If no timer is available, the timer is started again at next call of the periodic task */
+	if(p_global_scheduler->scheduleOnce(fct_ptr, delay_ms, this, TASK_PRIO_LOW))
+		pending_timer = 0;
+	else
+	{
+		pending_timer = fct_ptr;
+		pending_delay = delay_ms;
+	}
+}
 
-	/* Add periodic task in scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)&DisplayManagement::DisplaySensorData_Task, DISPLAY_MGT_PERIOD_TASK_SENSOR);
+void DisplayManagement::DisplayPage_Task(void* context)
+{
+	DisplayManagement* display_mgt_ptr = (DisplayManagement*)context;
 
-	/* Clear the screen */
-	ift_ptr->ClearFullScreen();
+	if(display_mgt_ptr->pending_timer != 0)
+		display_mgt_ptr->startTimer(display_mgt_ptr->pending_timer, display_mgt_ptr->pending_delay);
 
-	/* Call sensor data task manually to avoid a blank screen until the task is called by the scheduler */
-	DisplayManagement::DisplaySensorData_Task();
+	if(!display_mgt_ptr->isWelcomeDisplayed)
+		display_mgt_ptr->DisplayPage();
 }
 
-void DisplayManagement::DisplaySensorData_Task()
+void DisplayManagement::DisplayPage()
 {
+	T_DisplayManagement_Field field;
+	uint32_t signature;
+	uint8_t nb_fields = pgm_read_byte(&DisplayManagement_Page_list[current_page].nb_fields);
+	bool isRedrawn = isPageRedrawNeeded;
 
-	DisplayInterface* displayIft_ptr = p_global_ASW_DisplayManagement->GetIftPointer();
-	SensorManagement* sensor_ptr = p_global_ASW_DisplayManagement->GetSensorMgtPtr();
+	if(nb_fields > DISPLAY_MGT_MAX_FIELDS_PER_PAGE)
+		nb_fields = DISPLAY_MGT_MAX_FIELDS_PER_PAGE;
 
-	/* Display sensor data */
-	if(sensor_ptr !=0)
+	/* After a page change, the screen is cleared : only the characters which differ from the previous page will be sent to the screen */
+	if(isPageRedrawNeeded)
 	{
-		for(uint8_t i=0; i<sensor_ptr->getSensorCount(); i++)
+		p_display_ift->ClearFullScreen();
+
+		if(p_SensorMgt == 0)
 		{
-			String str;
-			sensor_ptr->getFullStringFormattedValue(i, &str);
-			displayIft_ptr->DisplayFullLine(&str, DISPLAY_MGT_FIRST_LINE_SENSORS + i, LINE_SHIFT);
+			StaticString<LCD_SIZE_NB_CHAR_PER_LINE> str;
+			str.appendString(FLASH_STRING(noSensorsDisplayString));
+			p_display_ift->DisplayFullLine(&str, 0, GO_TO_NEXT_LINE);
 		}
+
+		isPageRedrawNeeded = false;
 	}
-	else
-		displayIft_ptr->DisplayFullLine((uint8_t*)noSensorsDisplayString, sizeof(noSensorsDisplayString)/sizeof(uint8_t) - 1, DISPLAY_MGT_FIRST_LINE_SENSORS, GO_TO_NEXT_LINE);
 
-	/* TODO : position of time and date must depend of the number of sensors displayed */
+	/* Display only the fields whose data has changed */
+	for(uint8_t i = 0; i < nb_fields; i++)
+	{
+		readField(i, &field);
+		signature = getFieldSignature(&field);
+
+		if(isRedrawn || (signature != field_signature[i]))
+		{
+			DisplayField(&field);
+			field_signature[i] = signature;
+		}
+	}
+}
+
+void DisplayManagement::readField(uint8_t idx, T_DisplayManagement_Field* field)
+{
+	const T_DisplayManagement_Field* fields = (const T_DisplayManagement_Field*)pgm_read_word(&DisplayManagement_Page_list[current_page].fields);
+	const uint8_t* src = (const uint8_t*)&fields[idx];
+	uint8_t* dst = (uint8_t*)field;
+
+	for(uint8_t i = 0; i < sizeof(T_DisplayManagement_Field); i++)
+		dst[i] = pgm_read_byte(src + i);
+}
+
+uint32_t DisplayManagement::getFieldSignature(T_DisplayManagement_Field* field)
+{
+	uint32_t signature = 0;
+	uint16_t value;
+	uint8_t sensor_idx;
+	T_TimeManagement_TimeStruct* time_ptr;
+
+	switch(field->type)
+	{
+	case DISPLAY_FIELD_SENSOR_FULL:
+	case DISPLAY_FIELD_SENSOR_VALUE:
+		if(p_SensorMgt != 0)
+		{
+			sensor_idx = p_SensorMgt->getSensorIndex((T_SensorManagement_Sensor_Type)field->source);
+			if(sensor_idx != SENSOR_MGT_INVALID_IDX)
+				signature = ((uint32_t)p_SensorMgt->getValue(sensor_idx, &value) << 16) + value;
+		}
+		break;
 
-	/* Display time */
-	String str;
-	p_global_ASW_TimeManagement->FormatTimeString(&str, ':', true, false);
-	displayIft_ptr->DisplayFullLine(&str, 3, NORMAL);
+	case DISPLAY_FIELD_TIME:
+		time_ptr = p_global_ASW_TimeManagement->getCurrentTime();
+		signature = ((uint32_t)time_ptr->hours << 16) + ((uint16_t)time_ptr->minutes << 8) + time_ptr->seconds;
+		break;
 
+	case DISPLAY_FIELD_TEXT:
+	default:
+		/* Constant data, only displayed after a page change */
+		break;
+	}
+
+	return signature;
+}
+
+void DisplayManagement::DisplayField(T_DisplayManagement_Field* field)
+{
+	StaticString<LCD_SIZE_NB_CHAR_PER_LINE> str;
+	uint8_t sensor_idx;
+
+	switch(field->type)
+	{
+	case DISPLAY_FIELD_SENSOR_FULL:
+	case DISPLAY_FIELD_SENSOR_VALUE:
+		/* Sensor fields are not displayed if the sensor is not available */
+		if(p_SensorMgt == 0)
+			return;
+
+		sensor_idx = p_SensorMgt->getSensorIndex((T_SensorManagement_Sensor_Type)field->source);
+		if(sensor_idx == SENSOR_MGT_INVALID_IDX)
+			return;
+
+		if(field->type == DISPLAY_FIELD_SENSOR_FULL)
+			p_SensorMgt->getFullStringFormattedValue(sensor_idx, &str, true);
+		else
+			p_SensorMgt->getStringFormattedValue(sensor_idx, &str, true);
+
+		p_display_ift->DisplayText(str.getString(), str.getSize(), field->line, field->column, field->width);
+		break;
+
+	case DISPLAY_FIELD_TIME:
+		p_global_ASW_TimeManagement->FormatTimeString(&str, ':', true, false);
+		p_display_ift->DisplayText(str.getString(), str.getSize(), field->line, field->column, field->width);
+		break;
+
+	case DISPLAY_FIELD_TEXT:
+		/* Copy the text from flash memory */
+		str.appendString(FLASH_STRING(pgm_read_word(&DisplayManagement_Text_list[field->source])));
+		p_display_ift->DisplayText(str.getString(), str.getSize(), field->line, field->column, field->width);
+		break;
+
+	default:
+		break;
+	}
 }
@@ -12,11 +12,9 @@
 
 #define DISPLAY_MGT_LCD_I2C_ADDR 0x27 /*!< I2C address of the screen */
 
-#define DISPLAY_MGT_PERIOD_TASK_SENSOR 500 /*!< Display is updated every 0.5s */
+#define DISPLAY_MGT_PERIOD_TASK_PAGE 500 /*!< The fields of the current page are checked every 0.5s */
 #define DISPLAY_MGT_PERIOD_WELCOME_MSG_REMOVAL 5000 /*!< Time after which one the welcome message is removed */
 
-#define DISPLAY_MGT_FIRST_LINE_SENSORS 0 /*!< Sensors data are displayed starting on line 0 */
-
 #define DISPLAY_MGT_I2C_BITRATE (uint32_t)100000 /*!< I2C bus bitrate is 100 kHz */
 
 /*!
@@ -58,14 +56,25 @@ public:
 	DisplayManagement();
 
 	/*!
-	 * @brief Periodic task for displaying sensor data
-	 * @details This function displays the sensors data on the screen.
-	 * 			Currently temperature and humidity data coming from dht22 sensor are displayed. \n
+	 * @brief Periodic task for displaying the current page
+	 * @details This function displays the current page on the screen. Only the fields whose data has changed since the last call are formatted and displayed,
+	 * 			all the fields are displayed after a page change. Nothing is displayed while the welcome message is on the screen. \n
+	 * 			If the welcome message removal or the page rotation could not be scheduled, it is scheduled again by this task. \n
 	 * 			It is called periodically by scheduler.
 	 *
+	 * 	@param [in] context Pointer to the display management object
+	 * 	@return Nothing
+	 */
+	static void DisplayPage_Task(void* context);
+
+	/*!
+	 * @brief Page rotation task
+	 * @details This task selects the next page and displays it. It is scheduled once at each page change, after the display duration of the page.
+	 *
+	 * 	@param [in] arg Pointer to the display management object
 	 * 	@return Nothing
 	 */
-	static void DisplaySensorData_Task();
+	static void NextPage_Task(void* arg);
 
 	/*!
 	 * @brief Interface pointer get function
@@ -91,18 +100,71 @@ public:
 
 	/*!
 	 * @brief End of welcome message task
-	 * @details This task clears the welcome message from the screen and start periodic display of sensor data.
-	 * 			This task shall be added in scheduler when the welcome message is displayed on screen.
-	 * 			As it shall be called only once, the task removes itself from the scheduler after the first call.
+	 * @details This task clears the welcome message from the screen and starts the pages rotation.
+	 * 			This function shall be scheduled once when the welcome message is displayed on screen.
 	 *
+	 * 	@param [in] arg Pointer to the display management object
 	 * 	@return Nothing
 	 */
-	static void RemoveWelcomeMessage_Task();
+	static void RemoveWelcomeMessage_Task(void* arg);
 
 private:
 
 	DisplayInterface * p_display_ift; /*!< Pointer to the display interface object */
 	SensorManagement* p_SensorMgt; /*!< Pointer to the sensor management object */
+	uint8_t current_page; /*!< Index of the displayed page in DisplayManagement_Page_list */
+	bool isPageRedrawNeeded; /*!< Flag indicating that all the fields of the page shall be displayed */
+	uint32_t field_signature[DISPLAY_MGT_MAX_FIELDS_PER_PAGE]; /*!< Signature of the data displayed in each field of the page, used to detect changes */
+	bool isWelcomeDisplayed; /*!< Flag indicating that the welcome message is displayed, the page is not displayed until it is removed */
+	OneShotPtr_t pending_timer; /*!< Task of the one-shot timer which could not be scheduled, 0 if none */
+	uint16_t pending_delay; /*!< Delay of the one-shot timer which could not be scheduled */
+
+	/*!
+	 * @brief One-shot timer starting function
+	 * @details This function schedules the given task once after the given delay. If no timer is available, the request is memorized
+	 * 			and the periodic display task tries again at its next call.
+	 *
+	 * 	@param [in] fct_ptr Task to call at the end of the delay
+	 * 	@param [in] delay_ms Delay in ms
+	 * 	@return Nothing
+	 */
+	void startTimer(OneShotPtr_t fct_ptr, uint16_t delay_ms);
+
+	/*!
+	 * @brief Page display function
+	 * @details This function displays the fields of the current page whose signature has changed.
+	 *
+	 * 	@return Nothing
+	 */
+	void DisplayPage();
+
+	/*!
+	 * @brief Field reading function
+	 * @details This function copies the requested field of the current page from flash memory.
+	 *
+	 * 	@param [in] idx Index of the field in the page
+	 * 	@param [out] field Pointer to the field structure to fill
+	 * 	@return Nothing
+	 */
+	void readField(uint8_t idx, T_DisplayManagement_Field* field);
+
+	/*!
+	 * @brief Field signature computation function
+	 * @details This function computes a value identifying the data displayed in the field : the field needs to be displayed again only if its signature has changed.
+	 *
+	 * 	@param [in] field Pointer to the field
+	 * 	@return Signature of the field data
+	 */
+	uint32_t getFieldSignature(T_DisplayManagement_Field* field);
+
+	/*!
+	 * @brief Field display function
+	 * @details This function formats the data of the field and displays it at the field position.
+	 *
+	 * 	@param [in] field Pointer to the field
+	 * 	@return Nothing
+	 */
+	void DisplayField(T_DisplayManagement_Field* field);
 
 };
 
@@ -0,0 +1,60 @@
+/*!
+ * @file page_configuration.cpp
+ *
+ * @brief Display pages configuration file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#include "../../lib/string/String.h"
+
+#include "../sensors_mgt/SensorManagement.h"
+
+#include "page_configuration.h"
+
+const uint8_t pageTimeTitleString[] PROGMEM = "Heure"; /*!< Title of the time page */
+
+/*!
+ * @brief Texts table
+ * @details This table contains the constant texts displayed in the text fields.
+ */
+const uint8_t* const DisplayManagement_Text_list[] PROGMEM =
+{
+		pageTimeTitleString
+};
+
+/*!
+ * @brief Sensors page fields
+ */
+const T_DisplayManagement_Field pageSensors_Fields[] PROGMEM =
+{
+		{ DISPLAY_FIELD_SENSOR_FULL, TEMPERATURE, 0, 0, 20 },
+		{ DISPLAY_FIELD_SENSOR_FULL, HUMIDITY, 1, 0, 20 },
+		{ DISPLAY_FIELD_SENSOR_FULL, PRESSURE, 2, 0, 20 },
+		{ DISPLAY_FIELD_TIME, 0, 3, 0, 20 }
+};
+
+/*!
+ * @brief Time page fields
+ */
+const T_DisplayManagement_Field pageTime_Fields[] PROGMEM =
+{
+		{ DISPLAY_FIELD_TEXT, 0, 0, 0, 20 },
+		{ DISPLAY_FIELD_TIME, 0, 1, 6, 14 },
+		{ DISPLAY_FIELD_SENSOR_VALUE, TEMPERATURE, 3, 0, 10 },
+		{ DISPLAY_FIELD_SENSOR_VALUE, HUMIDITY, 3, 12, 8 }
+};
+
+/*!
+ * @brief Pages table
+ * @details This table contains the pages displayed in turn on the screen.
+ */
+const T_DisplayManagement_Page DisplayManagement_Page_list[DISPLAY_MGT_PAGE_NB] PROGMEM =
+{
+		{ pageSensors_Fields, sizeof(pageSensors_Fields)/sizeof(T_DisplayManagement_Field), 20000 },
+		{ pageTime_Fields, sizeof(pageTime_Fields)/sizeof(T_DisplayManagement_Field), 5000 }
+};
@@ -0,0 +1,58 @@
+/*!
+ * @file page_configuration.h
+ *
+ * @brief Display pages configuration header file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#ifndef WORK_ASW_DISPLAY_MGT_PAGE_CONFIGURATION_H_
+#define WORK_ASW_DISPLAY_MGT_PAGE_CONFIGURATION_H_
+
+#define DISPLAY_MGT_PAGE_NB 2 /*!< Number of pages displayed in turn */
+#define DISPLAY_MGT_MAX_FIELDS_PER_PAGE 6 /*!< Maximum number of fields in a page */
+
+/*!
+ * @brief Field type enumeration
+ * @details This enumeration defines the data which can be displayed in a field of a page.
+ */
+typedef enum
+{
+	DISPLAY_FIELD_SENSOR_FULL, /*!< Sensor data name, value and unit */
+	DISPLAY_FIELD_SENSOR_VALUE, /*!< Sensor value and unit */
+	DISPLAY_FIELD_TIME, /*!< Current time */
+	DISPLAY_FIELD_TEXT /*!< Constant text */
+}
+T_DisplayManagement_FieldType;
+
+/*!
+ * @brief Page field structure
+ * @details This structure defines a field of a page : the displayed data and its position on the screen.
+ */
+typedef struct
+{
+	uint8_t type; /*!< Type of the field (T_DisplayManagement_FieldType) */
+	uint8_t source; /*!< Sensor type (T_SensorManagement_Sensor_Type) for sensor fields, index in DisplayManagement_Text_list for text fields */
+	uint8_t line; /*!< Line of the field */
+	uint8_t column; /*!< First character of the field */
+	uint8_t width; /*!< Number of characters of the field */
+}
+T_DisplayManagement_Field;
+
+/*!
+ * @brief Page structure
+ * @details This structure defines a page of the screen.
+ */
+typedef struct
+{
+	const T_DisplayManagement_Field* fields; /*!< Pointer to the fields table of the page, in flash memory */
+	uint8_t nb_fields; /*!< Number of fields, limited to DISPLAY_MGT_MAX_FIELDS_PER_PAGE */
+	uint16_t duration; /*!< Time during which the page is displayed (ms) */
+}
+T_DisplayManagement_Page;
+
+extern const T_DisplayManagement_Page DisplayManagement_Page_list[DISPLAY_MGT_PAGE_NB] PROGMEM;
+extern const uint8_t* const DisplayManagement_Text_list[] PROGMEM;
+
+#endif /* WORK_ASW_DISPLAY_MGT_PAGE_CONFIGURATION_H_ */
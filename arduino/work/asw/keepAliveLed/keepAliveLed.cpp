@@ -9,7 +9,7 @@
 
 #include <avr/io.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../scheduler/scheduler.h"
 
 #include "../../bsw/dio/dio.h"
@@ -22,11 +22,11 @@ keepAliveLed* p_global_ASW_keepAliveLed;
 keepAliveLed::keepAliveLed()
 {
 	/* Add task blinLed_task to scheduler with period of 500ms */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&keepAliveLed::blinkLed_task), PERIOD_MS_TASK_LED);
+	p_global_scheduler->addPeriodicTask(&keepAliveLed::blinkLed_task, PERIOD_MS_TASK_LED, TASK_PRIO_LOW, p_global_BSW_dio);
 }
 
-void keepAliveLed::blinkLed_task()
+void keepAliveLed::blinkLed_task(void* context)
 {
 	/* Call DIO driver to invert LED pin state */
-	p_global_BSW_dio->dio_invertPort(LED_PORT);
+	((dio*)context)->dio_invertPort(LED_PORT);
 }
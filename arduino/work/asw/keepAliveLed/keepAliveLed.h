@@ -34,9 +34,10 @@ public:
 	 * @brief Task for LED blinking
 	 * @details This function is inserted into the scheduler. It changes the state of the LED output to make it blink
 	 *
+	 * @param [in] context Pointer to the DIO driver object
 	 * @return Nothing
 	 */
-	static void blinkLed_task();
+	static void blinkLed_task(void* context);
 
 private:
 
@@ -12,7 +12,7 @@
 #include <avr/io.h>
 #include <stdlib.h>
 
-#include "../../../lib/LinkedList/LinkedList.h"
+#include "../../../lib/StaticPool/StaticPool.h"
 #include "../../../lib/String/String.h"
 #include "../../../scheduler/scheduler.h"
 
@@ -32,7 +32,7 @@ HumSensor::HumSensor() : Sensor()
 		p_global_BSW_dht22 = new dht22(DHT22_PORT);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&HumSensor::readHumSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&HumSensor::readHumSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 }
 
 HumSensor::HumSensor(uint16_t val_tmo, uint16_t period) : Sensor(val_tmo, period)
@@ -42,18 +42,14 @@ HumSensor::HumSensor(uint16_t val_tmo, uint16_t period) : Sensor(val_tmo, period
 		p_global_BSW_dht22 = new dht22(DHT22_PORT);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&HumSensor::readHumSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&HumSensor::readHumSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 }
 
-void HumSensor::readHumSensor_task()
+void HumSensor::readHumSensor_task(void* context)
 {
-	HumSensor* hum_ptr = (HumSensor*)p_global_ASW_SensorManagement->getSensorObjectPtr(HUMIDITY);
-
-	if(hum_ptr != 0)
-		hum_ptr->setLastValidity(p_global_BSW_dht22->getHumidity(hum_ptr->getRawDataPtr()));
-	else
-		hum_ptr->setLastValidity(false);
+	HumSensor* hum_ptr = (HumSensor*)context;
 
+	hum_ptr->setLastValidity(p_global_BSW_dht22->getHumidity(hum_ptr->getRawDataPtr()));
 	hum_ptr->updateValidData();
 }
 
@@ -62,7 +58,7 @@ void HumSensor::readHumSensor_task()
 bool HumSensor::updateTaskPeriod(uint16_t period)
 {
 	task_period = period;
-	return p_global_scheduler->updateTaskPeriod((TaskPtr_t)(&HumSensor::readHumSensor_task), task_period);
+	return p_global_scheduler->updateTaskPeriod(task_handle, task_period);
 }
 
 
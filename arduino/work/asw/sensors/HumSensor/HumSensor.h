@@ -37,9 +37,10 @@ public:
 	/*!
 	 * @brief Task for reading humidity values
 	 * @details This task reads humidity data using DHT22 driver. It is called periodically.
+	 * @param [in] context Pointer to the humidity sensor object
 	 * @return Nothing
 	 */
-	static void readHumSensor_task();
+	static void readHumSensor_task(void* context);
 
 	/*!
 	 * @brief Task period update
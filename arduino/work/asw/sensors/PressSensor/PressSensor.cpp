@@ -10,7 +10,7 @@
 #include <avr/io.h>
 #include <stdlib.h>
 
-#include "../../../lib/LinkedList/LinkedList.h"
+#include "../../../lib/StaticPool/StaticPool.h"
 #include "../../../lib/String/String.h"
 #include "../../../scheduler/scheduler.h"
 
@@ -32,7 +32,7 @@ PressSensor::PressSensor() : Sensor()
 	p_global_BSW_bmp180->ActivatePressureConversion(task_period);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&PressSensor::readPressSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&PressSensor::readPressSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 }
 
 PressSensor::PressSensor(uint16_t val_tmo, uint16_t period) : Sensor(val_tmo, period)
@@ -44,19 +44,15 @@ PressSensor::PressSensor(uint16_t val_tmo, uint16_t period) : Sensor(val_tmo, pe
 	p_global_BSW_bmp180->ActivatePressureConversion(task_period);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&PressSensor::readPressSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&PressSensor::readPressSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 }
 
-void PressSensor::readPressSensor_task()
+void PressSensor::readPressSensor_task(void* context)
 {
-	PressSensor* temp_ptr = (PressSensor*)p_global_ASW_SensorManagement->getSensorObjectPtr(PRESSURE);
+	PressSensor* press_ptr = (PressSensor*)context;
 
-	if(temp_ptr != 0)
-		temp_ptr->setLastValidity(p_global_BSW_bmp180->getPressureValue(temp_ptr->getRawDataPtr()));
-	else
-		temp_ptr->setLastValidity(false);
-
-	temp_ptr->updateValidData();
+	press_ptr->setLastValidity(p_global_BSW_bmp180->getPressureValue(press_ptr->getRawDataPtr()));
+	press_ptr->updateValidData();
 
 }
 
@@ -64,5 +60,5 @@ void PressSensor::readPressSensor_task()
 bool PressSensor::updateTaskPeriod(uint16_t period)
 {
 	task_period = period;
-	return p_global_scheduler->updateTaskPeriod((TaskPtr_t)(&PressSensor::readPressSensor_task), task_period);
+	return p_global_scheduler->updateTaskPeriod(task_handle, task_period);
 }
@@ -39,9 +39,10 @@ public:
 	 * @brief Task for reading pressure values
 	 * @details This task reads pressure data using BMP180 driver. It is called periodically.
 	 *
+	 * @param [in] context Pointer to the pressure sensor object
 	 * @return Nothing
 	 */
-	static void readPressSensor_task();
+	static void readPressSensor_task(void* context);
 
 	/*!
 	 * @brief Task period update
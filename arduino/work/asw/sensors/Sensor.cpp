@@ -10,9 +10,14 @@
 #include <stdlib.h>
 #include <avr/io.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
+#include "../../lib/string/String.h"
 #include "../../scheduler/scheduler.h"
 
+#include "../../bsw/usart/usart.h"
+
+#include "../debug_ift/DebugInterface.h"
+#include "../telemetry/Telemetry.h"
 #include "Sensor.h"
 
 #define TASK_PERIOD_DEFAULT 1000 /*!< Default sensor task period : 1s */
@@ -32,6 +37,8 @@ Sensor::Sensor()
 	validity_tmo = VALIDITY_TIMEOUT_MS_DEFAULT/SW_PERIOD_MS;
 
 	task_period = TASK_PERIOD_DEFAULT;
+	task_handle = SCHEDULER_INVALID_HANDLE;
+	sensor_id = 0;
 
 }
 
@@ -48,10 +55,16 @@ Sensor::Sensor(uint16_t val_tmo, uint16_t period)
 	validity_tmo = val_tmo/SW_PERIOD_MS;
 
 	task_period = period;
+	task_handle = SCHEDULER_INVALID_HANDLE;
+	sensor_id = 0;
 }
 
 void Sensor::updateValidData()
 {
+	/* Each read is a new sample for the telemetry stream */
+	if(p_global_ASW_Telemetry != 0)
+		p_global_ASW_Telemetry->sendSample(sensor_id, validity_last_read, raw_data);
+
 	if (validity_last_read == true)
 	{
 		valid_value = raw_data;
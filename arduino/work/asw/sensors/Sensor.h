@@ -41,9 +41,10 @@ public:
 	 * @brief Task for reading sensor values
 	 * @details This task reads sensor data using sensor driver. It is called periodically.
 	 * 			This function shall be re-written in each inherited class.
+	 * @param [in] context Pointer to the sensor object
 	 * @return Nothing
 	 */
-	static void readSensor_task(){}
+	static void readSensor_task(void* context){}
 
 	/*!
 	 * @brief Get pointer to raw sensor data
@@ -151,6 +152,18 @@ public:
 		validity_tmo = timeout;
 	}
 
+	/*!
+	 * @brief Sensor identifier setting function
+	 * @details This function sets the identifier of the sensor, which is its index in the sensor configuration table. It is used to identify the samples sent on the telemetry stream.
+	 *
+	 * @param [in] id Identifier of the sensor
+	 * @return Nothing
+	 */
+	inline void setSensorId(uint8_t id)
+	{
+		sensor_id = id;
+	}
+
 protected:
 	bool validity; /*!< Validity of sensor data */
 	bool validity_last_read; /*!< Validity of last read sensor data */
@@ -164,6 +177,10 @@ protected:
 
 	uint16_t task_period; /*!< Task period */
 
+	uint8_t sensor_id; /*!< Index of the sensor in the configuration table */
+
+	TaskHandle_t task_handle; /*!< Handle of the sensor task in the scheduler */
+
 };
 
 #endif /* WORK_ASW_SENSORS_SENSOR_H_ */
@@ -10,7 +10,7 @@
 #include <avr/io.h>
 #include <stdlib.h>
 
-#include "../../../lib/LinkedList/LinkedList.h"
+#include "../../../lib/StaticPool/StaticPool.h"
 #include "../../../lib/String/String.h"
 #include "../../../scheduler/scheduler.h"
 
@@ -39,7 +39,7 @@ TempSensor::TempSensor() : Sensor()
 	p_global_BSW_bmp180->ActivateTemperatureConversion(task_period);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&TempSensor::readTempSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&TempSensor::readTempSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 
 }
 
@@ -56,57 +56,53 @@ TempSensor::TempSensor(uint16_t val_tmo, uint16_t period) : Sensor(val_tmo, peri
 	p_global_BSW_bmp180->ActivateTemperatureConversion(task_period);
 
 	/* Add task to scheduler */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&TempSensor::readTempSensor_task), task_period);
+	task_handle = p_global_scheduler->addPeriodicTask(&TempSensor::readTempSensor_task, task_period, TASK_PRIO_MEDIUM, this);
 }
 
-void TempSensor::readTempSensor_task()
+void TempSensor::readTempSensor_task(void* context)
 {
-	TempSensor* temp_ptr = (TempSensor*)p_global_ASW_SensorManagement->getSensorObjectPtr(TEMPERATURE);
+	TempSensor* temp_ptr = (TempSensor*)context;
 
-	if(temp_ptr != 0)
-	{
-		/* Get temperature values from both sensors */
-		uint16_t temperature1, temperature2;
-		bool val1, val2;
+	/* Get temperature values from both sensors */
+	uint16_t temperature1, temperature2;
+	bool val1, val2;
 
-		val1 = p_global_BSW_dht22->getTemperature(&temperature1);
-		val2 = p_global_BSW_bmp180->getTemperatureValue(&temperature2);
+	val1 = p_global_BSW_dht22->getTemperature(&temperature1);
+	val2 = p_global_BSW_bmp180->getTemperatureValue(&temperature2);
 
-		/* If both sensors are valid, check if the values are similar */
-		if(val1 && val2)
-		{
-			if(((temperature1 > temperature2) && ((temperature1 - temperature2) < TEMP_SENSOR_VALUE_ACCEPTABLE_DIFFERENCE))
-				|| ((temperature1 <= temperature2) && ((temperature2 - temperature1) < TEMP_SENSOR_VALUE_ACCEPTABLE_DIFFERENCE)))
-			{
-				/* Sensors return similar values, set validity to true and update sensor value */
-				temp_ptr->setLastValidity(true);
-				*(temp_ptr->getRawDataPtr()) = (temperature1 + temperature2)/2;
-			}
-			else
-			{
-				/* Else set validity to false */
-				temp_ptr->setLastValidity(false);
-			}
-		}
-		/* If only one sensor is valid, use this value */
-		else if(val1)
-		{
-			temp_ptr->setLastValidity(true);
-			*(temp_ptr->getRawDataPtr()) = temperature1;
-		}
-		else if(val2)
+	/* If both sensors are valid, check if the values are similar */
+	if(val1 && val2)
+	{
+		if(((temperature1 > temperature2) && ((temperature1 - temperature2) < TEMP_SENSOR_VALUE_ACCEPTABLE_DIFFERENCE))
+			|| ((temperature1 <= temperature2) && ((temperature2 - temperature1) < TEMP_SENSOR_VALUE_ACCEPTABLE_DIFFERENCE)))
 		{
+			/* Sensors return similar values, set validity to true and update sensor value */
 			temp_ptr->setLastValidity(true);
-			*(temp_ptr->getRawDataPtr()) = temperature2;
+			*(temp_ptr->getRawDataPtr()) = (temperature1 + temperature2)/2;
 		}
-		/* If no sensor is valid, validity is set to false */
 		else
+		{
+			/* Else set validity to false */
 			temp_ptr->setLastValidity(false);
-
-		/* Update validity data */
-		temp_ptr->updateValidData();
+		}
+	}
+	/* If only one sensor is valid, use this value */
+	else if(val1)
+	{
+		temp_ptr->setLastValidity(true);
+		*(temp_ptr->getRawDataPtr()) = temperature1;
+	}
+	else if(val2)
+	{
+		temp_ptr->setLastValidity(true);
+		*(temp_ptr->getRawDataPtr()) = temperature2;
 	}
+	/* If no sensor is valid, validity is set to false */
+	else
+		temp_ptr->setLastValidity(false);
 
+	/* Update validity data */
+	temp_ptr->updateValidData();
 }
 
 
@@ -114,5 +110,5 @@ void TempSensor::readTempSensor_task()
 bool TempSensor::updateTaskPeriod(uint16_t period)
 {
 	task_period = period;
-	return p_global_scheduler->updateTaskPeriod((TaskPtr_t)(&TempSensor::readTempSensor_task), task_period);
+	return p_global_scheduler->updateTaskPeriod(task_handle, task_period);
 }
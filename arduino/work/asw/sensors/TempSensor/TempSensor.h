@@ -42,9 +42,10 @@ public:
 	 * @brief Task for reading temperature values
 	 * @details This task reads temperature data using DHT22 and BMP180 drivers. It is called periodically.
 	 * 			The returned temperature is the mean between both sensors values, if only one sensor is valid, only this value is used .
+	 * @param [in] context Pointer to the temperature sensor object
 	 * @return Nothing
 	 */
-	static void readTempSensor_task();
+	static void readTempSensor_task(void* context);
 
 	/*!
 	 * @brief Task period update
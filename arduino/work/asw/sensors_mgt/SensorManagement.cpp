@@ -9,10 +9,13 @@
 
 #include <stdlib.h>
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../lib/String/String.h"
 
+#include "../../scheduler/scheduler.h"
+
 #include "../sensors/Sensor.h"
 #include "../sensors/TempSensor/TempSensor.h"
 #include "../sensors/HumSensor/HumSensor.h"
@@ -54,6 +57,9 @@ SensorManagement::SensorManagement()
 			}
 			break;
 		}
+
+		/* The index in the configuration table identifies the sensor */
+		((Sensor*)(sensor_ptr_table[i]))->setSensorId(i);
 	}
 }
 
@@ -74,7 +80,7 @@ bool SensorManagement::updateTaskPeriod(uint16_t period)
 	return retval;
 }
 
-void SensorManagement::getFullStringFormattedValue(uint8_t sensor_idx, String* str)
+void SensorManagement::getFullStringFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat)
 {
 	str->Clear();
 	str->appendString(SensorManagement_Sensor_Config_list[sensor_idx].data_name_str);
@@ -82,29 +88,58 @@ void SensorManagement::getFullStringFormattedValue(uint8_t sensor_idx, String* s
 	str->appendChar((uint8_t)':');
 	str->appendSpace();
 
+	appendFormattedValue(sensor_idx, str, isDisplayFormat);
+}
+
+void SensorManagement::getStringFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat)
+{
+	str->Clear();
+	appendFormattedValue(sensor_idx, str, isDisplayFormat);
+}
+
+void SensorManagement::appendFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat)
+{
 	if(((Sensor*)(sensor_ptr_table[sensor_idx]))->getValidity())
 	{
 		str->appendInteger(((Sensor*)(sensor_ptr_table[sensor_idx]))->getValueInteger(), 10);
 		str->appendChar((uint8_t)'.');
 		str->appendInteger(((Sensor*)(sensor_ptr_table[sensor_idx]))->getValueDecimal(), 10);
 		str->appendSpace();
-		str->appendString(SensorManagement_Sensor_Config_list[sensor_idx].unit_str);
+		if(isDisplayFormat)
+			str->appendString(SensorManagement_Sensor_Config_list[sensor_idx].display_unit_str);
+		else
+			str->appendString(SensorManagement_Sensor_Config_list[sensor_idx].unit_str);
 	}
 	else
-		str->appendString((uint8_t*)"invalide");
+		str->appendString(FSTR("invalide"));
 }
 
-void* SensorManagement::getSensorObjectPtr(T_SensorManagement_Sensor_Type type)
+bool SensorManagement::getValue(uint8_t sensor_idx, uint16_t* value)
+{
+	return ((Sensor*)(sensor_ptr_table[sensor_idx]))->getValue(value);
+}
+
+uint8_t SensorManagement::getSensorIndex(T_SensorManagement_Sensor_Type type)
 {
-	void* retval = 0;
 	uint8_t idx = 0;
 
 	/* Find the index of the corresponding sensor */
 	while((idx < nb_sensors) && (SensorManagement_Sensor_Config_list[idx].sensor_type != type))
 		idx++;
 
+	if(idx >= nb_sensors)
+		idx = SENSOR_MGT_INVALID_IDX;
+
+	return idx;
+}
+
+void* SensorManagement::getSensorObjectPtr(T_SensorManagement_Sensor_Type type)
+{
+	void* retval = 0;
+	uint8_t idx = getSensorIndex(type);
+
 	/* If the sensor has been found */
-	if(idx < nb_sensors)
+	if(idx != SENSOR_MGT_INVALID_IDX)
 	{
 		/* Get the object pointer */
 		retval = sensor_ptr_table[idx];
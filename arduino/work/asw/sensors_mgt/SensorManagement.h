@@ -10,6 +10,9 @@
 #ifndef WORK_ASW_SENSORS_MGT_SENSORMANAGEMENT_H_
 #define WORK_ASW_SENSORS_MGT_SENSORMANAGEMENT_H_
 
+#define SENSOR_MGT_INVALID_IDX 0xFF /*!< Index returned when a sensor is not configured */
+#define SENSOR_MGT_STRING_MAX_SIZE 24 /*!< Maximum size of a formatted sensor value string */
+
 /*!
  * @brief Sensor type enumeration
  * @details This enumeration defines all types of sensors available.
@@ -62,12 +65,44 @@ public:
 	/*!
 	 * @brief Sensor value formatting function.
 	 * @details This function gets the value of the selected sensor and formats it into a string using the data name string defined in the configuration.
+	 * 			For the screen, the unit string may contain glyphs which can not be sent on the debug link.
 	 *
 	 * @param [in] sensor_idx Index of the requested sensor
 	 * @param [out] str Pointer to the formatted string
+	 * @param [in] isDisplayFormat True if the string will be displayed on the screen
 	 * @return Nothing
 	 */
-	void getFullStringFormattedValue(uint8_t sensor_idx, String* str);
+	void getFullStringFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat = false);
+
+	/*!
+	 * @brief Sensor value formatting function.
+	 * @details This function gets the value of the selected sensor and formats it into a string with its unit, without the data name.
+	 *
+	 * @param [in] sensor_idx Index of the requested sensor
+	 * @param [out] str Pointer to the formatted string
+	 * @param [in] isDisplayFormat True if the string will be displayed on the screen
+	 * @return Nothing
+	 */
+	void getStringFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat = false);
+
+	/*!
+	 * @brief Sensor value get function
+	 * @details This function returns the last valid value of the selected sensor, multiplied by 10.
+	 *
+	 * @param [in] sensor_idx Index of the requested sensor
+	 * @param [out] value Sensor value
+	 * @return Validity of the value
+	 */
+	bool getValue(uint8_t sensor_idx, uint16_t* value);
+
+	/*!
+	 * @brief Sensor index get function
+	 * @details This function finds the index of the sensor of the given type in the configuration table.
+	 *
+	 * @param [in] type Type of sensor to find
+	 * @return Index of the sensor, SENSOR_MGT_INVALID_IDX if the sensor is not configured
+	 */
+	uint8_t getSensorIndex(T_SensorManagement_Sensor_Type type);
 
 	/*!
 	 * @brief Sensor object pointer get function
@@ -82,6 +117,17 @@ private:
 
 	uint8_t nb_sensors; /*!< Number of sensors */
 	void** sensor_ptr_table; /*!< Table containing pointers to all sensors objects (declared as pointer to void to avoid including Sensor.h in all files) */
+
+	/*!
+	 * @brief Sensor value appending function.
+	 * @details This function appends the value of the selected sensor and its unit to the string, or "invalide" if the value is not valid.
+	 *
+	 * @param [in] sensor_idx Index of the requested sensor
+	 * @param [in,out] str Pointer to the string to complete
+	 * @param [in] isDisplayFormat True if the string will be displayed on the screen
+	 * @return Nothing
+	 */
+	void appendFormattedValue(uint8_t sensor_idx, String* str, bool isDisplayFormat);
 };
 
 extern SensorManagement* p_global_ASW_SensorManagement; /*!< Pointer to the SensorManagement object */
@@ -9,16 +9,26 @@
 
 #include <stdlib.h>
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
 #include "../../lib/String/String.h"
 
+#include "../display_ift/DisplayGlyphs.h"
+
 #include "SensorManagement.h"
 #include "sensor_configuration.h"
 
 #define SENSOR_MGT_CNF_DEFAULT_PERIOD 3000 /*!< Default period for sensors task */
 #define SENSOR_MGT_CNF_DEFAULT_TMO 15000 /*!< Default timeout value for sensors */
 
+const uint8_t tempNameString[] PROGMEM = "T"; /*!< Temperature data name */
+const uint8_t tempUnitString[] PROGMEM = "degC"; /*!< Temperature unit */
+const uint8_t displayTempUnitString[] PROGMEM = {DISPLAY_GLYPH_CODE(DISPLAY_GLYPH_DEGREE), 'C', 0}; /*!< Temperature unit displayed on the screen, with degree glyph */
+const uint8_t humNameString[] PROGMEM = "H"; /*!< Humidity data name */
+const uint8_t humUnitString[] PROGMEM = "%"; /*!< Humidity unit */
+const uint8_t pressNameString[] PROGMEM = "P"; /*!< Pressure data name */
+const uint8_t pressUnitString[] PROGMEM = "hPa"; /*!< Pressure unit */
+
 /*!
  * @brief Sensor configuration table
  */
@@ -28,21 +38,24 @@ T_SensorManagement_Sensor_Config SensorManagement_Sensor_Config_list[3] =
 				TEMPERATURE,
 				SENSOR_MGT_CNF_DEFAULT_PERIOD,
 				SENSOR_MGT_CNF_DEFAULT_TMO,
-				(uint8_t*)"T",
-				(uint8_t*)"degC"
+				FLASH_STRING(tempNameString),
+				FLASH_STRING(tempUnitString),
+				FLASH_STRING(displayTempUnitString)
 		},
 		{
 				HUMIDITY,
 				SENSOR_MGT_CNF_DEFAULT_PERIOD,
 				SENSOR_MGT_CNF_DEFAULT_TMO,
-				(uint8_t*)"H",
-				(uint8_t*)"%"
+				FLASH_STRING(humNameString),
+				FLASH_STRING(humUnitString),
+				FLASH_STRING(humUnitString)
 		},
 		{
 				PRESSURE,
 				SENSOR_MGT_CNF_DEFAULT_PERIOD,
 				SENSOR_MGT_CNF_DEFAULT_TMO,
-				(uint8_t*)"P",
-				(uint8_t*)"hPa"
+				FLASH_STRING(pressNameString),
+				FLASH_STRING(pressUnitString),
+				FLASH_STRING(pressUnitString)
 		}
 };
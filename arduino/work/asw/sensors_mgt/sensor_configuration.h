@@ -19,8 +19,9 @@ typedef struct
 	T_SensorManagement_Sensor_Type sensor_type; /* Type of the sensor */
 	uint16_t period; /* Period of the sensor periodic task */
 	uint16_t validity_tmo; /* Validity timeout */
-	uint8_t* data_name_str; /* Pointer to the string containing the data name */
-	uint8_t* unit_str; /* Pointer to the string containing the unit of the sensor data */
+	const FlashString* data_name_str; /* Pointer to the string containing the data name, in flash memory */
+	const FlashString* unit_str; /* Pointer to the string containing the unit of the sensor data, in flash memory */
+	const FlashString* display_unit_str; /* Pointer to the string containing the unit displayed on the screen, it may contain glyphs, in flash memory */
 }
 T_SensorManagement_Sensor_Config;
 
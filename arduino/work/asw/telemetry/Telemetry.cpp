@@ -0,0 +1,175 @@
+/*!
+ * @file Telemetry.cpp
+ *
+ * @brief Telemetry class source code file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#include <stdlib.h>
+#include <avr/io.h>
+#include <util/crc16.h>
+
+#include "../../lib/StaticPool/StaticPool.h"
+#include "../../lib/string/String.h"
+
+#include "../../scheduler/scheduler.h"
+
+#include "../../bsw/usart/usart.h"
+
+#include "../sensors_mgt/SensorManagement.h"
+#include "../debug_ift/DebugInterface.h"
+#include "Telemetry.h"
+
+Telemetry* p_global_ASW_Telemetry;
+
+
+Telemetry::Telemetry()
+{
+	/* Create a new interface object if needed and attach it to the class */
+	if(p_global_ASW_DebugInterface == 0)
+		p_global_ASW_DebugInterface = new DebugInterface();
+
+	debug_ift_ptr = p_global_ASW_DebugInterface;
+
+	/* One decimation counter is needed for each sensor */
+	if(p_global_ASW_SensorManagement != 0)
+		nb_sensors = p_global_ASW_SensorManagement->getSensorCount();
+	else
+		nb_sensors = 0;
+
+	decimation_cnt = (uint8_t*)malloc(nb_sensors * sizeof(uint8_t));
+
+	isStreamActive = false;
+	decimation = 1;
+	time_ms = 0;
+	last_ticks = 0;
+	dropped_frames = 0;
+}
+
+void Telemetry::start()
+{
+	/* The first sample of each sensor is sent */
+	for(uint8_t i=0; i<nb_sensors; i++)
+		decimation_cnt[i] = 0;
+
+	time_ms = 0;
+	last_ticks = p_global_scheduler->getTimerTicks();
+	dropped_frames = 0;
+
+	/* A frame is sent entirely or not at all */
+	debug_ift_ptr->setTxPolicy(USART_TX_POLICY_DROP);
+
+	/* The data sent before are ended as a frame, the receiver is synchronized on the first sample */
+	debug_ift_ptr->sendChar(TELEMETRY_FRAME_DELIMITER);
+
+	isStreamActive = true;
+}
+
+void Telemetry::stop()
+{
+	isStreamActive = false;
+
+	/* The debug menu waits for free space to avoid losing text */
+	debug_ift_ptr->setTxPolicy(USART_TX_POLICY_BLOCK);
+}
+
+void Telemetry::setDecimation(uint8_t factor)
+{
+	if(factor == 0)
+		factor = 1;
+
+	decimation = factor;
+}
+
+void Telemetry::sendSample(uint8_t sensor_id, bool validity, uint16_t value)
+{
+	uint8_t payload[TELEMETRY_PAYLOAD_SIZE];
+	uint8_t frame[TELEMETRY_FRAME_MAX_SIZE];
+	uint8_t size;
+	uint16_t crc;
+
+	if(!isStreamActive || (sensor_id >= nb_sensors))
+		return;
+
+	/* Skip the samples removed by the decimation */
+	if(decimation_cnt[sensor_id] != 0)
+	{
+		decimation_cnt[sensor_id]--;
+		return;
+	}
+
+	decimation_cnt[sensor_id] = decimation - 1;
+
+	updateTime();
+
+	/* Build the payload */
+	payload[0] = sensor_id;
+	if(!validity)
+		payload[0] |= TELEMETRY_INVALID_FLAG;
+
+	payload[1] = (uint8_t)(time_ms & 0xFF);
+	payload[2] = (uint8_t)((time_ms >> 8) & 0xFF);
+	payload[3] = (uint8_t)((time_ms >> 16) & 0xFF);
+	payload[4] = (uint8_t)((time_ms >> 24) & 0xFF);
+
+	payload[5] = (uint8_t)(value & 0xFF);
+	payload[6] = (uint8_t)((value >> 8) & 0xFF);
+
+	crc = computeCRC(payload, TELEMETRY_PAYLOAD_SIZE - 2);
+	payload[7] = (uint8_t)(crc & 0xFF);
+	payload[8] = (uint8_t)((crc >> 8) & 0xFF);
+
+	/* Encode the frame and send it */
+	size = encodeCOBS(payload, TELEMETRY_PAYLOAD_SIZE, frame);
+	frame[size++] = TELEMETRY_FRAME_DELIMITER;
+
+	if(!debug_ift_ptr->sendBuffer(frame, size))
+		dropped_frames++;
+}
+
+void Telemetry::updateTime()
+{
+	uint32_t elapsed_ms = (p_global_scheduler->getTimerTicks() - last_ticks) / SCHEDULER_TICKS_PER_MS;
+
+	time_ms += elapsed_ms;
+	last_ticks += elapsed_ms * SCHEDULER_TICKS_PER_MS;
+}
+
+uint8_t Telemetry::encodeCOBS(uint8_t* data, uint8_t size, uint8_t* frame)
+{
+	uint8_t code_idx = 0;
+	uint8_t code = 1;
+	uint8_t frame_idx = 1;
+
+	for(uint8_t i=0; i<size; i++)
+	{
+		if(data[i] == 0)
+		{
+			/* Close the current block : its code byte is the distance to this null byte */
+			frame[code_idx] = code;
+			code_idx = frame_idx++;
+			code = 1;
+		}
+		else
+		{
+			frame[frame_idx++] = data[i];
+			code++;
+		}
+	}
+
+	frame[code_idx] = code;
+
+	return frame_idx;
+}
+
+uint16_t Telemetry::computeCRC(uint8_t* data, uint8_t size)
+{
+	uint16_t crc = TELEMETRY_CRC_INIT;
+
+	for(uint8_t i=0; i<size; i++)
+		crc = _crc_xmodem_update(crc, data[i]);
+
+	return crc;
+}
@@ -0,0 +1,155 @@
+/*!
+ * @file Telemetry.h
+ *
+ * @brief Telemetry class header file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#ifndef WORK_ASW_TELEMETRY_TELEMETRY_H_
+#define WORK_ASW_TELEMETRY_TELEMETRY_H_
+
+#define TELEMETRY_PAYLOAD_SIZE 9 /*!< Size of a sample payload : sensor identifier (1), timestamp (4), value (2) and CRC (2) */
+#define TELEMETRY_FRAME_MAX_SIZE (TELEMETRY_PAYLOAD_SIZE + 2) /*!< Size of an encoded frame : COBS overhead byte, payload and delimiter */
+#define TELEMETRY_FRAME_DELIMITER 0x00 /*!< Byte ending each frame, it never appears inside an encoded frame */
+#define TELEMETRY_INVALID_FLAG 0x80 /*!< Flag set in the sensor identifier byte when the read value is not valid */
+#define TELEMETRY_CRC_INIT 0xFFFF /*!< Initial value of the CRC16 (CCITT polynomial 0x1021) */
+
+/*!
+ * @brief Binary telemetry class
+ * @details This class sends the sensor samples on the USART link as binary frames, instead of the text data of the debug menu.
+ * 			Each sample is sent in a frame containing the sensor identifier, a timestamp in milliseconds since the start of the stream, the value multiplied by 10 and a CRC16.
+ * 			All multi-bytes fields are little endian. The frame is encoded with COBS (Consistent Overhead Byte Stuffing) and ended by a null byte,
+ * 			so the receiver can synchronize on any frame.\n
+ * 			Only one sample out of the decimation factor is sent for each sensor.
+ */
+class Telemetry {
+
+public:
+
+	/*!
+	 * @brief Class constructor
+	 * @details This function initializes the class. If needed, it creates a new instance of debug interface object.
+	 * 			The stream is stopped and all samples are sent by default.
+	 *
+	 * @return Nothing
+	 */
+	Telemetry();
+
+	/*!
+	 * @brief Stream start function
+	 * @details This function starts sending the samples on the USART link. The timestamp and the decimation counters are reset.
+	 * 			A frame which does not fit in the USART transmission buffer is dropped, the sensor tasks are never blocked by the stream.
+	 *
+	 * @return Nothing
+	 */
+	void start();
+
+	/*!
+	 * @brief Stream stop function
+	 * @details This function stops sending the samples and restores the default USART transmission policy for the debug menu.
+	 *
+	 * @return Nothing
+	 */
+	void stop();
+
+	/*!
+	 * @brief Stream state get function
+	 * @details This function returns the state of the stream.
+	 *
+	 * @return True if the samples are sent, false otherwise
+	 */
+	inline bool isActive()
+	{
+		return isStreamActive;
+	}
+
+	/*!
+	 * @brief Decimation setting function
+	 * @details This function sets the decimation factor : only one sample out of the given number is sent for each sensor.
+	 *
+	 * @param [in] factor Decimation factor, 1 to send all samples
+	 * @return Nothing
+	 */
+	void setDecimation(uint8_t factor);
+
+	/*!
+	 * @brief Decimation get function
+	 * @details This function returns the decimation factor.
+	 *
+	 * @return Decimation factor
+	 */
+	inline uint8_t getDecimation()
+	{
+		return decimation;
+	}
+
+	/*!
+	 * @brief Dropped frames get function
+	 * @details This function returns the number of frames dropped since the start of the stream because the USART transmission buffer was full.
+	 *
+	 * @return Number of dropped frames
+	 */
+	inline uint16_t getDroppedFrames()
+	{
+		return dropped_frames;
+	}
+
+	/*!
+	 * @brief Sample sending function
+	 * @details This function is called by the sensors for each new sample. If the stream is active and the sample is not removed by the decimation,
+	 * 			the frame is built and queued in the USART transmission buffer.
+	 *
+	 * @param [in] sensor_id Identifier of the sensor (index in the sensor configuration table)
+	 * @param [in] validity Validity of the sample
+	 * @param [in] value Value of the sample, multiplied by 10
+	 * @return Nothing
+	 */
+	void sendSample(uint8_t sensor_id, bool validity, uint16_t value);
+
+private:
+
+	DebugInterface* debug_ift_ptr; /*!< Pointer to the debug interface object, which is used to send data on usart link */
+	bool isStreamActive; /*!< Samples are sent when this flag is set */
+	uint8_t decimation; /*!< Decimation factor */
+	uint8_t nb_sensors; /*!< Number of sensors */
+	uint8_t* decimation_cnt; /*!< Number of samples to skip before the next sent sample, for each sensor */
+	uint32_t time_ms; /*!< Time elapsed since the start of the stream (ms) */
+	uint32_t last_ticks; /*!< Scheduler time corresponding to time_ms */
+	uint16_t dropped_frames; /*!< Number of frames dropped since the start of the stream */
+
+	/*!
+	 * @brief Timestamp update function
+	 * @details This function adds the time elapsed since the last update to the stream time. The remainder of the scheduler ticks is kept for the next update.
+	 *
+	 * @return Nothing
+	 */
+	void updateTime();
+
+	/*!
+	 * @brief COBS encoding function
+	 * @details This function encodes the payload using Consistent Overhead Byte Stuffing : each null byte is replaced by the distance to the next null byte.
+	 * 			The encoded frame is one byte longer than the payload, the delimiter is not added. The payload shall be shorter than 254 bytes.
+	 *
+	 * @param [in] data Pointer to the payload
+	 * @param [in] size Size of the payload
+	 * @param [out] frame Pointer to the encoded frame
+	 * @return Size of the encoded frame
+	 */
+	static uint8_t encodeCOBS(uint8_t* data, uint8_t size, uint8_t* frame);
+
+	/*!
+	 * @brief CRC computation function
+	 * @details This function computes the CRC16 of the given data with the CCITT polynomial (0x1021), initialized to TELEMETRY_CRC_INIT.
+	 *
+	 * @param [in] data Pointer to the data
+	 * @param [in] size Size of the data
+	 * @return Computed CRC
+	 */
+	static uint16_t computeCRC(uint8_t* data, uint8_t size);
+};
+
+extern Telemetry* p_global_ASW_Telemetry; /*!< Pointer to the Telemetry object */
+
+#endif /* WORK_ASW_TELEMETRY_TELEMETRY_H_ */
@@ -10,7 +10,7 @@
 #include <avr/io.h>
 
 #include "../../lib/string/String.h"
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../scheduler/scheduler.h"
 
 #include "../../bsw/usart/usart.h"
@@ -37,12 +37,12 @@ TimeManagement::TimeManagement()
 	current_time.hours = 0;
 
 	/* Start periodic task */
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&TimeManagement::TimeComputation_task), PERIOD_TIME_COMPUTATION_TASK);
+	p_global_scheduler->addPeriodicTask(&TimeManagement::TimeComputation_task, PERIOD_TIME_COMPUTATION_TASK, TASK_PRIO_HIGH, this);
 }
 
-void TimeManagement::TimeComputation_task()
+void TimeManagement::TimeComputation_task(void* context)
 {
-	p_global_ASW_TimeManagement->UpdateCurrentTime();
+	((TimeManagement*)context)->UpdateCurrentTime();
 }
 
 void TimeManagement::UpdateCurrentTime()
@@ -45,9 +45,10 @@ public:
 	 * @brief Time management periodic task
 	 * @details This function is called periodically by the scheduler. It calls the time computation function.
 	 *
+	 * @param [in] context Pointer to the time management object
 	 * @return Nothing.
 	 */
-	static void TimeComputation_task();
+	static void TimeComputation_task(void* context);
 
 	/*!
 	 * @brief Time computation function
@@ -18,6 +18,13 @@ I2C::I2C(uint32_t l_bitrate)
 {
 	bitrate = l_bitrate;
 
+	queue_head = 0;
+	queue_count = 0;
+	tx_idx = 0;
+	rx_idx = 0;
+	isReadPhase = false;
+	isBusHeld = false;
+
 	initializeBus();
 }
 
@@ -28,127 +35,261 @@ bool I2C::writeByte(uint8_t data, uint8_t tx_address, bool sendStopCond)
 
 bool I2C::write(uint8_t* data, uint8_t tx_address, uint8_t size, bool sendStopCond)
 {
-	/* Disable interrupt during the communication */
-	cli();
-
-	/* Send START condition */
-	TWCR = (1<<TWINT)|(1<<TWSTA)|(1<<TWEN);
+	return runTransaction(tx_address, data, size, 0, 0, sendStopCond);
+}
 
-	/* Wait until TWINT flag is set */
-	while (!(TWCR & (1<<TWINT)));
+bool I2C::read(uint8_t i2c_address, uint8_t size, uint8_t* buf_ptr)
+{
+	return runTransaction(i2c_address, 0, 0, buf_ptr, size, true);
+}
 
-	/* If an error has occurred, stop the transmission */
-	if ((TWSR & 0xF8) != START)
-		return false;
+bool I2C::writeRead(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size)
+{
+	return runTransaction(i2c_address, tx_data, tx_size, rx_buf, rx_size, true);
+}
 
-	/* Load I2C address into TWDR register and start transmission of the address
-	 * The address is shifted by 1 bit to the left, as bit 0 of SLA word is for RW condition
-	 * Here we are in a write process, then bit 0 is set to 0 */
-	TWDR = (tx_address << 1);
-	TWCR = (1<<TWINT) | (1<<TWEN);
+bool I2C::writeAsync(uint8_t* data, uint8_t tx_address, uint8_t size, I2CCallback_t callback, void* context)
+{
+	return queueTransaction(tx_address, data, size, 0, 0, true, callback, context, false);
+}
 
-	/* Wait until TWINT flag is set */
-	while (!(TWCR & (1<<TWINT)));
+bool I2C::readAsync(uint8_t i2c_address, uint8_t size, uint8_t* buf_ptr, I2CCallback_t callback, void* context)
+{
+	return queueTransaction(i2c_address, 0, 0, buf_ptr, size, true, callback, context, false);
+}
 
-	/* If an error has occurred, stop the transmission */
-	if ((TWSR & 0xF8) != SLAW_ACK)
-		return false;
+bool I2C::writeReadAsync(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, I2CCallback_t callback, void* context)
+{
+	return queueTransaction(i2c_address, tx_data, tx_size, rx_buf, rx_size, true, callback, context, false);
+}
 
-	for(int i = 0; i<size; i++)
-	{
-		/* Load data into TWDR and start transmission */
-		TWDR = data[i];
-		TWCR = (1<<TWINT) | (1<<TWEN);
+void I2C::flush()
+{
+	while(queue_count != 0)
+		waitBusEvent();
+}
 
-		/* Wait until TWINT flag is set */
-		while (!(TWCR & (1<<TWINT)));
+void I2C::interruptHandler()
+{
+	I2CTransaction_t* transaction = &queue[queue_head];
 
-		/* If an error has occurred, stop the transmission */
-		if ((TWSR & 0xF8) != DATA_ACK)
-			return false;
+	/* Nothing to do if no transaction is running, disable the interrupt */
+	if(queue_count == 0)
+	{
+		TWCR = (1<<TWEN);
+		return;
 	}
 
-	/* Send STOP condition */
-	if(sendStopCond)
-		TWCR = (1<<TWINT)|(1<<TWEN)|(1<<TWSTO);
-
-	/* Re-enable interrupts at the end of communication */
-	sei();
+	switch(TWSR & 0xF8)
+	{
+	/* START condition sent : send the address of the device
+	 * The address is shifted by 1 bit to the left, as bit 0 of SLA word is for RW condition */
+	case START:
+	case REPEATED_START:
+		if(isReadPhase)
+			TWDR = (transaction->address << 1) | 1;
+		else
+			TWDR = (transaction->address << 1);
+
+		TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWIE);
+		break;
+
+	/* Address or data sent : send the next data, or go to the read phase, or end the transaction */
+	case SLAW_ACK:
+	case DATA_ACK:
+		if(tx_idx < transaction->tx_size)
+		{
+			TWDR = transaction->tx_ptr[tx_idx];
+			tx_idx++;
+			TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWIE);
+		}
+		else if(transaction->rx_size != 0)
+		{
+			isReadPhase = true;
+			TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+		}
+		else
+			endTransaction(true);
+		break;
+
+	/* Data received : store it and continue.
+	 * ACK pulse is sent after each received byte except for the last one */
+	case DATA_RECEIVED_ACK:
+		transaction->rx_ptr[rx_idx] = TWDR;
+		rx_idx++;
+		/* no break */
+	case SLAR_ACK:
+		if((transaction->rx_size - rx_idx) > 1)
+			TWCR = (1<<TWINT) | (1<<TWEA) | (1<<TWEN) | (1<<TWIE);
+		else
+			TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWIE);
+		break;
+
+	case DATA_RECEIVED_NACK:
+		transaction->rx_ptr[rx_idx] = TWDR;
+		rx_idx++;
+		endTransaction(true);
+		break;
+
+	/* Any other status is an error : NACK received, arbitration lost or bus error */
+	default:
+		endTransaction(false);
+		break;
+	}
+}
 
-	return true;
+void I2C::setBitRate(uint32_t l_bitrate)
+{
+	bitrate = l_bitrate;
 }
 
-bool I2C::read(uint8_t i2c_address, uint8_t size, uint8_t* buf_ptr)
+void I2C::initializeBus()
 {
-	/* Disable interrupt during the communication */
-	cli();
+	uint8_t data = 0;
 
-	uint8_t idx = 0;
+	/* Bit rate configuration */
 
-	/* Send START condition */
-	TWCR = (1<<TWINT)|(1<<TWSTA)|(1<<TWEN);
+	/* Prescaler value is fixed to 1 (TWPS1 = 0 and TWPS0 = 0), then only TWBR value shall be computed.*/
+	TWSR &= 0b11111100; /* Clear TWPS bits */
+
+	/* Compute value of register TWBR : SCL freq = F_CPU / (16 + 2*TWBR*(4^TWPS))
+	 * => TWBR = ((FCPU / SCL freq) - 16)/8 */
+	data = (uint8_t)(((F_CPU / bitrate) - 16) / 8);
+	TWBR = data;
+}
 
-	/* Wait until TWINT flag is set */
-	while (!(TWCR & (1<<TWINT)));
+bool I2C::queueTransaction(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, bool sendStopCond, I2CCallback_t callback, void* context, bool isBlocking)
+{
+	I2CTransaction_t* transaction;
+	uint8_t sreg;
 
-	/* If an error has occurred, stop */
-	if (((TWSR & 0xF8) != START) && ((TWSR & 0xF8) != REPEATED_START))
+	/* An empty transaction would go to the read phase without reception buffer */
+	if((tx_size == 0) && (rx_size == 0))
 		return false;
 
-	/* Load I2C address into TWDR register and start transmission of the address
-	 * The address is shifted by 1 bit to the left, as bit 0 of SLA word is for RW condition
-	 * Here we are in a read process, then bit 0 is set to 1 */
-	TWDR = (i2c_address << 1) | 1;
-	TWCR = (1<<TWINT) | (1<<TWEN);
+	/* Wait for a free place in the queue if requested */
+	while(1)
+	{
+		sreg = SREG;
+		cli();
 
-	/* Wait until TWINT flag is set */
-	while (!(TWCR & (1<<TWINT)));
+		if(queue_count < I2C_QUEUE_SIZE)
+			break;
 
-	/* If an error has occurred, stop the transmission */
-	if ((TWSR & 0xF8) != SLAR_ACK)
-		return false;
+		SREG = sreg;
 
-	while(size > 0)
-	{
-		/* Clear TWINT flag and activate ACK pulse transmission (except for the last byte to receive) */
-		if(size==1)
-			TWCR = (1<<TWINT) | (1<<TWEN) ;
-		else
-			TWCR = (1<<TWINT) | (1<<TWEA) | (1<<TWEN) ;
+		if(!isBlocking)
+			return false;
 
-		/* Wait until TWINT flag is set to read data */
-		while (!(TWCR & (1<<TWINT)));
+		waitBusEvent();
+	}
+
+	transaction = &queue[(queue_head + queue_count) % I2C_QUEUE_SIZE];
+	transaction->address = i2c_address;
+	transaction->tx_size = tx_size;
+	transaction->rx_ptr = rx_buf;
+	transaction->rx_size = rx_size;
+	transaction->sendStopCond = sendStopCond;
+	transaction->callback = callback;
+	transaction->context = context;
+
+	/* Small data are copied, the caller does not have to keep them */
+	if(tx_size <= I2C_TX_INLINE_SIZE)
+	{
+		for(uint8_t i = 0; i < tx_size; i++)
+			transaction->tx_inline[i] = tx_data[i];
 
-		buf_ptr[idx] = TWDR;
-		idx++;
-		size--;
+		transaction->tx_ptr = transaction->tx_inline;
 	}
+	else
+		transaction->tx_ptr = tx_data;
 
-	/* Send STOP condition */
-	TWCR = (1<<TWINT)|(1<<TWEN)|(1<<TWSTO);
+	queue_count++;
 
-	/* Re-enable interrupts at the end of communication */
-	sei();
+	/* Start the transaction now if the bus is free */
+	if(queue_count == 1)
+		startTransaction();
+
+	SREG = sreg;
 
 	return true;
 }
 
-void I2C::setBitRate(uint32_t l_bitrate)
+bool I2C::runTransaction(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, bool sendStopCond)
 {
-	bitrate = l_bitrate;
+	volatile uint8_t status = I2C_SYNC_PENDING;
+
+	if(!queueTransaction(i2c_address, tx_data, tx_size, rx_buf, rx_size, sendStopCond, &I2C::syncCallback, (void*)&status, true))
+		return false;
+
+	while(status == I2C_SYNC_PENDING)
+		waitBusEvent();
+
+	return (status == I2C_SYNC_SUCCESS);
 }
 
-void I2C::initializeBus()
+void I2C::syncCallback(void* context, bool status)
 {
-	uint8_t data = 0;
+	if(status)
+		*((volatile uint8_t*)context) = I2C_SYNC_SUCCESS;
+	else
+		*((volatile uint8_t*)context) = I2C_SYNC_FAILED;
+}
 
-	/* Bit rate configuration */
+void I2C::waitBusEvent()
+{
+	/* If interrupts are disabled, the TWI interrupt can not be raised : the flag is polled and the state machine is called directly */
+	if(!(SREG & (1 << SREG_I)))
+	{
+		while (!(TWCR & (1<<TWINT)));
+		interruptHandler();
+	}
+}
 
-	/* Prescaler value is fixed to 1 (TWPS1 = 0 and TWPS0 = 0), then only TWBR value shall be computed.*/
-	TWSR &= 0b11111100; /* Clear TWPS bits */
+void I2C::startTransaction()
+{
+	tx_idx = 0;
+	rx_idx = 0;
+	isReadPhase = (queue[queue_head].tx_size == 0);
 
-	/* Compute value of register TWBR : SCL freq = F_CPU / (16 + 2*TWBR*(4^TWPS))
-	 * => TWBR = ((FCPU / SCL freq) - 16)/8 */
-	data = (uint8_t)(((F_CPU / bitrate) - 16) / 8);
-	TWBR = data;
+	/* If the bus has been released by the previous transaction, wait for the end of the STOP condition.
+	 * If the bus is still held, a REPEATED START condition is sent */
+	if(!isBusHeld)
+	{
+		while(TWCR & (1<<TWSTO));
+	}
+
+	isBusHeld = false;
+
+	/* Send START condition */
+	TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN) | (1<<TWIE);
+}
+
+void I2C::endTransaction(bool status)
+{
+	I2CCallback_t callback = queue[queue_head].callback;
+	void* context = queue[queue_head].context;
+
+	/* Send STOP condition, the bus is always released after an error.
+	 * Otherwise the bus is held : the interrupt is disabled and TWINT flag is kept set until the next START condition */
+	if(queue[queue_head].sendStopCond || !status)
+	{
+		TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWSTO);
+		isBusHeld = false;
+	}
+	else
+	{
+		TWCR = (1<<TWEN);
+		isBusHeld = true;
+	}
+
+	/* Remove the transaction from the queue and start the next one */
+	queue_head = (queue_head + 1) % I2C_QUEUE_SIZE;
+	queue_count--;
+
+	if(queue_count != 0)
+		startTransaction();
+
+	if(callback != 0)
+		(*callback)(context, status);
 }
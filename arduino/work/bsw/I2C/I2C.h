@@ -15,12 +15,47 @@
 #define SLAW_ACK 0x18 /*!< TWSR status code : SLA+W has been transmitted and ACK has been received */
 #define DATA_ACK 0x28 /*!< TWSR status code : DATA has been transmitted and ACK has been received */
 #define SLAR_ACK 0x40 /*!< TWSR status code : SLA+R has been transmitted and ACK has been received */
+#define DATA_RECEIVED_ACK 0x50 /*!< TWSR status code : DATA has been received and ACK has been returned */
+#define DATA_RECEIVED_NACK 0x58 /*!< TWSR status code : DATA has been received and NOT ACK has been returned */
 
+#define I2C_QUEUE_SIZE 8 /*!< Maximum number of transactions waiting in the queue, including the running one */
+#define I2C_TX_INLINE_SIZE 2 /*!< Data to send up to this size are copied in the transaction, the caller buffer can then be released immediately */
+
+#define I2C_SYNC_PENDING 0 /*!< Status of a synchronous transaction : transaction is running */
+#define I2C_SYNC_SUCCESS 1 /*!< Status of a synchronous transaction : transaction has succeeded */
+#define I2C_SYNC_FAILED 2 /*!< Status of a synchronous transaction : transaction has failed */
+
+/*!
+ * @brief Type defining a transaction completion callback
+ * @details The callback is called in interrupt context at the end of the transaction, with the context given when the transaction has been queued and the result of the transaction.
+ */
+typedef void (*I2CCallback_t)(void* context, bool status);
+
+/*!
+ * @brief Type defining an I2C transaction
+ * @details A transaction sends tx_size bytes to the device and then reads rx_size bytes, after a REPEATED START condition if both sizes are not 0.
+ */
+typedef struct
+{
+	uint8_t address; /*!< I2C address of the device */
+	uint8_t* tx_ptr; /*!< Pointer to the data to send */
+	uint8_t tx_inline[I2C_TX_INLINE_SIZE]; /*!< Copy of the data to send if it is small enough */
+	uint8_t tx_size; /*!< Number of bytes to send */
+	uint8_t* rx_ptr; /*!< Pointer to the reception buffer */
+	uint8_t rx_size; /*!< Number of bytes to read */
+	bool sendStopCond; /*!< Defines if the stop condition shall be sent at the end of the transaction or if the bus is kept for the next one */
+	I2CCallback_t callback; /*!< Function called at the end of the transaction, can be 0 */
+	void* context; /*!< Context given to the callback */
+}
+I2CTransaction_t;
 
 
 /*!
  * @brief Two-wire serial interface (I2C) class definition
  * @details This class manages I2C driver.
+ * 			The transfers are driven by the TWI interrupt : transactions are put into a queue and are processed one after the other by the interrupt state machine.
+ * 			Asynchronous functions return as soon as the transaction is queued, the result is given to the completion callback.
+ * 			Synchronous functions queue a transaction and wait for its end, they can be used with interrupts disabled.
  */
 class I2C {
 public:
@@ -47,7 +82,7 @@ public:
 
 	/*!
 	 * @brief I2C write function
-	 * @details This function sends the requested number of bytes to the I2C device with the given address
+	 * @details This function sends the requested number of bytes to the I2C device with the given address and waits for the end of the transmission.
 	 *
 	 * @param [in] data Pointer to the data to send
 	 * @param [in] tx_address I2C address of the device
@@ -70,6 +105,111 @@ public:
 	 */
 	bool read(uint8_t i2c_address, uint8_t size, uint8_t* buf_ptr);
 
+	/*!
+	 * @brief I2C write then read function
+	 * @details This function sends the requested bytes to the device, then reads the requested number of bytes after a REPEATED START condition, and waits for the end of the transaction.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] tx_data Pointer to the data to send
+	 * @param [in] tx_size Number of bytes to send
+	 * @param [out] rx_buf Pointer to the reception buffer
+	 * @param [in] rx_size Number of bytes to read
+	 * @return True if the transaction has succeeded, false otherwise
+	 */
+	bool writeRead(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size);
+
+	/*!
+	 * @brief Register read function
+	 * @details This function reads len consecutive registers of the device, starting at register reg, in a single transaction :
+	 * 			the register address is sent, then the registers are read in burst after a REPEATED START condition. The function waits for the end of the transaction.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] reg Address of the first register to read
+	 * @param [out] buf Pointer to the reception buffer
+	 * @param [in] len Number of registers to read
+	 * @return True if the transaction has succeeded, false otherwise
+	 */
+	inline bool readRegisters(uint8_t i2c_address, uint8_t reg, uint8_t* buf, uint8_t len)
+	{
+		return writeRead(i2c_address, &reg, 1, buf, len);
+	}
+
+	/*!
+	 * @brief Asynchronous write function
+	 * @details This function queues the sending of the requested bytes to the device and returns immediately.
+	 * 			If size is greater than I2C_TX_INLINE_SIZE, the data shall stay valid until the end of the transaction.
+	 *
+	 * @param [in] data Pointer to the data to send
+	 * @param [in] tx_address I2C address of the device
+	 * @param [in] size Number of bytes to send
+	 * @param [in] callback Function called at the end of the transaction, can be 0
+	 * @param [in] context Context given to the callback
+	 * @return True if the transaction has been queued, false if the queue is full or if there is no byte to send or read
+	 */
+	bool writeAsync(uint8_t* data, uint8_t tx_address, uint8_t size, I2CCallback_t callback = 0, void* context = 0);
+
+	/*!
+	 * @brief Asynchronous read function
+	 * @details This function queues the reading of the requested number of bytes and returns immediately. The reception buffer shall stay valid until the end of the transaction.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] size Number of bytes to read
+	 * @param [out] buf_ptr Pointer to the reception buffer
+	 * @param [in] callback Function called at the end of the transaction, can be 0
+	 * @param [in] context Context given to the callback
+	 * @return True if the transaction has been queued, false if the queue is full or if there is no byte to send or read
+	 */
+	bool readAsync(uint8_t i2c_address, uint8_t size, uint8_t* buf_ptr, I2CCallback_t callback = 0, void* context = 0);
+
+	/*!
+	 * @brief Asynchronous write then read function
+	 * @details This function queues a write followed by a read after a REPEATED START condition and returns immediately. The reception buffer shall stay valid until the end of the transaction.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] tx_data Pointer to the data to send
+	 * @param [in] tx_size Number of bytes to send
+	 * @param [out] rx_buf Pointer to the reception buffer
+	 * @param [in] rx_size Number of bytes to read
+	 * @param [in] callback Function called at the end of the transaction, can be 0
+	 * @param [in] context Context given to the callback
+	 * @return True if the transaction has been queued, false if the queue is full or if there is no byte to send or read
+	 */
+	bool writeReadAsync(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, I2CCallback_t callback = 0, void* context = 0);
+
+	/*!
+	 * @brief Asynchronous register read function
+	 * @details This function queues the burst read of len consecutive registers starting at register reg and returns immediately. The reception buffer shall stay valid until the end of the transaction.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] reg Address of the first register to read
+	 * @param [out] buf Pointer to the reception buffer
+	 * @param [in] len Number of registers to read
+	 * @param [in] callback Function called at the end of the transaction, can be 0
+	 * @param [in] context Context given to the callback
+	 * @return True if the transaction has been queued, false if the queue is full or if there is no byte to send or read
+	 */
+	inline bool readRegistersAsync(uint8_t i2c_address, uint8_t reg, uint8_t* buf, uint8_t len, I2CCallback_t callback = 0, void* context = 0)
+	{
+		return writeReadAsync(i2c_address, &reg, 1, buf, len, callback, context);
+	}
+
+	/*!
+	 * @brief Queue flushing function
+	 * @details This function waits until all the queued transactions are done.
+	 *
+	 * @return Nothing
+	 */
+	void flush();
+
+	/*!
+	 * @brief TWI interrupt function
+	 * @details This function is called by the TWI interrupt each time a bus operation is done. It runs the state machine of the current transaction,
+	 * 			calls the completion callback at the end of the transaction and starts the next one.
+	 *
+	 * @return Nothing
+	 */
+	void interruptHandler();
+
 	/*!
 	 * @brief Variable bitrate setting function
 	 * @details This function sets the class variable bitrate as requested in parameter.
@@ -82,6 +222,14 @@ public:
 private:
 	uint32_t bitrate;
 
+	I2CTransaction_t queue[I2C_QUEUE_SIZE]; /*!< Circular queue of transactions, the first one is the running transaction */
+	uint8_t queue_head; /*!< Index of the running transaction in the queue */
+	volatile uint8_t queue_count; /*!< Number of transactions in the queue */
+	uint8_t tx_idx; /*!< Number of bytes sent in the running transaction */
+	uint8_t rx_idx; /*!< Number of bytes read in the running transaction */
+	bool isReadPhase; /*!< Flag indicating that the write part of the running transaction is done */
+	bool isBusHeld; /*!< Flag indicating that the last transaction has ended without stop condition */
+
 	/*!
 	 * @brief I2C bus initialization
 	 * @details This function initializes the I2C bus, it resets the bus and configure the bitrate as requested.
@@ -91,6 +239,73 @@ private:
 	 * @return Nothing
 	 */
 	void initializeBus();
+
+	/*!
+	 * @brief Transaction queuing function
+	 * @details This function adds a transaction at the end of the queue and starts it if the bus is free.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] tx_data Pointer to the data to send
+	 * @param [in] tx_size Number of bytes to send
+	 * @param [out] rx_buf Pointer to the reception buffer
+	 * @param [in] rx_size Number of bytes to read
+	 * @param [in] sendStopCond Defines if the stop condition shall be sent at the end of the transaction
+	 * @param [in] callback Function called at the end of the transaction
+	 * @param [in] context Context given to the callback
+	 * @param [in] isBlocking If true, the function waits for a free place when the queue is full
+	 * @return True if the transaction has been queued, false if the queue is full or if there is no byte to send or read
+	 */
+	bool queueTransaction(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, bool sendStopCond, I2CCallback_t callback, void* context, bool isBlocking);
+
+	/*!
+	 * @brief Synchronous transaction function
+	 * @details This function queues a transaction and waits for its end.
+	 *
+	 * @param [in] i2c_address I2C address of the device
+	 * @param [in] tx_data Pointer to the data to send
+	 * @param [in] tx_size Number of bytes to send
+	 * @param [out] rx_buf Pointer to the reception buffer
+	 * @param [in] rx_size Number of bytes to read
+	 * @param [in] sendStopCond Defines if the stop condition shall be sent at the end of the transaction
+	 * @return True if the transaction has succeeded, false otherwise
+	 */
+	bool runTransaction(uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_size, uint8_t* rx_buf, uint8_t rx_size, bool sendStopCond);
+
+	/*!
+	 * @brief Synchronous transaction completion callback
+	 * @details This function writes the result of the transaction in the status variable of the waiting function.
+	 *
+	 * @param [in] context Pointer to the status variable
+	 * @param [in] status Result of the transaction
+	 * @return Nothing
+	 */
+	static void syncCallback(void* context, bool status);
+
+	/*!
+	 * @brief Interrupt wait function
+	 * @details This function waits for the next bus event. If interrupts are disabled, the TWI interrupt flag is polled and the state machine is called directly.
+	 *
+	 * @return Nothing
+	 */
+	void waitBusEvent();
+
+	/*!
+	 * @brief Transaction start function
+	 * @details This function sends the START condition of the first transaction of the queue. Interrupts shall be disabled.
+	 *
+	 * @return Nothing
+	 */
+	void startTransaction();
+
+	/*!
+	 * @brief Transaction end function
+	 * @details This function ends the running transaction : it sends the stop condition if needed, removes the transaction from the queue,
+	 * 			starts the next one and calls the completion callback.
+	 *
+	 * @param [in] status Result of the transaction
+	 * @return Nothing
+	 */
+	void endTransaction(bool status);
 };
 
 extern I2C* p_global_BSW_i2c; /*!< Pointer to I2C driver object */
@@ -9,11 +9,10 @@
 
 #include <avr/io.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../scheduler/scheduler.h"
 
 #include "../I2C/I2C.h"
-#include "../timer/timer.h"
 #include "Bmp180.h"
 
 Bmp180* p_global_BSW_bmp180;
@@ -24,10 +23,6 @@ Bmp180::Bmp180()
 	if(p_global_BSW_i2c == 0)
 		p_global_BSW_i2c = new I2C(BMP180_I2C_BITRATE);
 
-	/* Create timer object if it is still not initialized */
-	if(p_global_BSW_timer == 0)
-		p_global_BSW_timer = new timer();
-
 	i2c_drv_ptr = p_global_BSW_i2c;
 
 	/* Set status to OK */
@@ -57,7 +52,7 @@ Bmp180::Bmp180()
 
 	/* Add monitoring function into scheduler */
 	task_period = BMP180_MONITORING_DEFAULT_PERIOD;
-	p_global_scheduler->addPeriodicTask((TaskPtr_t)(&Bmp180::Bmp180Monitoring_Task), task_period);
+	monitoring_task_handle = p_global_scheduler->addPeriodicTask(&Bmp180::Bmp180Monitoring_Task, task_period, TASK_PRIO_HIGH, this);
 }
 
 void Bmp180::readCalibData()
@@ -67,39 +62,33 @@ void Bmp180::readCalibData()
 	if(status == IDLE)
 	{
 		uint8_t buf_calib_data[sizeof(T_BMP180_calib_data)];
-		ret_status = i2c_drv_ptr->writeByte(BMP180_CHIP_ID_CALIB_EEP_START_ADDR, BMP180_I2C_ADDR, false);
+		ret_status = i2c_drv_ptr->readRegisters(BMP180_I2C_ADDR, BMP180_CHIP_ID_CALIB_EEP_START_ADDR, buf_calib_data, sizeof(T_BMP180_calib_data));
 
 		if(ret_status)
 		{
-			ret_status = i2c_drv_ptr->read(BMP180_I2C_ADDR, sizeof(T_BMP180_calib_data), buf_calib_data);
-			if(ret_status)
+			/* Check that the read has been correctly performed,
+			 * none of the calibration data shall be equal to 0 or 0xffff */
+			uint16_t* cal = (uint16_t*)buf_calib_data;
+			for(uint8_t i=0; i<sizeof(T_BMP180_calib_data)/2; i++)
 			{
-				/* Check that the read has been correctly performed,
-				 * none of the calibration data shall be equal to 0 or 0xffff */
-				uint16_t* cal = (uint16_t*)buf_calib_data;
-				for(uint8_t i=0; i<sizeof(T_BMP180_calib_data)/2; i++)
-				{
-					if((*cal == 0) || (*cal == 0xffff))
-						status = COMM_FAILED;
+				if((*cal == 0) || (*cal == 0xffff))
+					status = COMM_FAILED;
 
-					cal++;
-				}
+				cal++;
+			}
 
-				/* If the status is still OK, copy the buffer into the calibration data structure
-				 * An inversion is done between MSB and LSB during the copy because AtMega2560 is little endian */
-				if(status == IDLE)
+			/* If the status is still OK, copy the buffer into the calibration data structure
+			 * An inversion is done between MSB and LSB during the copy because AtMega2560 is little endian */
+			if(status == IDLE)
+			{
+				uint8_t* ptr = (uint8_t*)&calibration_data;
+				for(uint8_t i=0; i<sizeof(T_BMP180_calib_data); i=i+2)
 				{
-					uint8_t* ptr = (uint8_t*)&calibration_data;
-					for(uint8_t i=0; i<sizeof(T_BMP180_calib_data); i=i+2)
-					{
-						*ptr = buf_calib_data[i+1];
-						*(ptr+1) = buf_calib_data[i];
-						ptr=ptr+2;;
-					}
+					*ptr = buf_calib_data[i+1];
+					*(ptr+1) = buf_calib_data[i];
+					ptr=ptr+2;;
 				}
 			}
-			else
-				status = COMM_FAILED;
 		}
 		else
 			status = COMM_FAILED;
@@ -112,15 +101,9 @@ void Bmp180::readChipID()
 
 	if(status == IDLE)
 	{
-		ret_status = i2c_drv_ptr->writeByte(BMP180_CHIP_ID_EEP_ADDR, BMP180_I2C_ADDR, false);
+		ret_status = i2c_drv_ptr->readRegisters(BMP180_I2C_ADDR, BMP180_CHIP_ID_EEP_ADDR, &chip_id, 1);
 
-		if(ret_status)
-		{
-			ret_status = i2c_drv_ptr->read(BMP180_I2C_ADDR, 1, &chip_id);
-			if((chip_id != BMP180_CHIP_ID_EXPECTED) || (!ret_status))
-				status = COMM_FAILED;
-		}
-		else
+		if((chip_id != BMP180_CHIP_ID_EXPECTED) || (!ret_status))
 			status = COMM_FAILED;
 	}
 }
@@ -145,16 +128,13 @@ void Bmp180::startNewTemperatureConversion()
 
 	if(status == IDLE)
 	{
+		/* The command is sent in background, the driver status is set as failed by the completion callback if the transmission fails */
 		uint8_t data[2] = {BMP180_CTRL_MEAS_EEP_ADDR, BMP180_CTRL_MEAS_START_TEMP_CONV};
-		ret_status = i2c_drv_ptr->write(data, BMP180_I2C_ADDR, 2, true);
+		ret_status = i2c_drv_ptr->writeAsync(data, BMP180_I2C_ADDR, 2, &Bmp180::conversionStart_callback, this);
 
-		/* If the conversion is started, start a timer, else set the driver status as failed */
-		if(ret_status)
-		{
-			p_global_BSW_timer->configureTimer3(BMP180_TIMER_PRESCALER_VALUE, BMP180_TEMP_MEAS_TIMER_CTC_VALUE);
-			p_global_BSW_timer->startTimer3();
+		/* If the conversion is started, schedule the end of conversion, else set the driver status as failed */
+		if(ret_status && p_global_scheduler->scheduleOnce(&Bmp180::conversionEnd_callback, BMP180_TEMP_MEAS_WAITING_TIME, this, TASK_PRIO_HIGH))
 			status = TEMP_CONV_IN_PROGRESS;
-		}
 		else
 			status = COMM_FAILED;
 	}
@@ -166,72 +146,58 @@ void Bmp180::startNewPressureConversion()
 
 	if(status == IDLE)
 	{
+		/* The command is sent in background, the driver status is set as failed by the completion callback if the transmission fails */
 		uint8_t data[2] = {BMP180_CTRL_MEAS_EEP_ADDR, BMP180_CTRL_MEAS_START_PRESS_CONV_OSS0};
-		ret_status = i2c_drv_ptr->write(data, BMP180_I2C_ADDR, 2, true);
+		ret_status = i2c_drv_ptr->writeAsync(data, BMP180_I2C_ADDR, 2, &Bmp180::conversionStart_callback, this);
 
-		/* If the conversion is started, start a timer, else set the driver status as failed */
-		if(ret_status)
-		{
-			p_global_BSW_timer->configureTimer3(BMP180_TIMER_PRESCALER_VALUE, BMP180_PRESS_MEAS_OSS0_TIMER_CTC_VALUE);
-			p_global_BSW_timer->startTimer3();
+		/* If the conversion is started, schedule the end of conversion, else set the driver status as failed */
+		if(ret_status && p_global_scheduler->scheduleOnce(&Bmp180::conversionEnd_callback, BMP180_PRESS_MEAS_OSS0_WAITING_TIME, this, TASK_PRIO_HIGH))
 			status = PRESSURE_CONV_IN_PROGRESS;
-		}
 		else
 			status = COMM_FAILED;
 	}
 }
 
-void Bmp180::conversionTimerInterrupt()
+void Bmp180::conversionStart_callback(void* context, bool i2c_status)
 {
-	bool ret_status;
+	if(!i2c_status)
+		((Bmp180*)context)->status = COMM_FAILED;
+}
 
-	/* Stop timer */
-	p_global_BSW_timer->stopTimer3();
+void Bmp180::conversionEnd_callback(void* arg)
+{
+	((Bmp180*)arg)->conversionEnd();
+}
+
+void Bmp180::conversionEnd()
+{
+	bool ret_status;
 
 	/* If driver status is OK and a conversion is in progress */
 	if(status != COMM_FAILED)
 	{
-		/* Read the result in sensor EEPROM */
-		ret_status = i2c_drv_ptr->writeByte(BMP180_OUT_REG_LSB_EEPROM_ADDR, BMP180_I2C_ADDR, false);
+		/* Read the result in sensor EEPROM : MSB and LSB registers are read in a single transaction */
+		uint8_t out_reg[BMP180_OUT_REG_SIZE_OSS0];
+		ret_status = i2c_drv_ptr->readRegisters(BMP180_I2C_ADDR, BMP180_OUT_REG_MSB_EEPROM_ADDR, out_reg, BMP180_OUT_REG_SIZE_OSS0);
 
 		if(ret_status)
 		{
-			uint8_t lsb, msb;
-			ret_status = i2c_drv_ptr->read(BMP180_I2C_ADDR, 1, &lsb);
+			uint16_t RawValue = (out_reg[0] << 8) + out_reg[1];
+			/* Convert the value in real temperature or pressure */
+			if(status == TEMP_CONV_IN_PROGRESS)
+			{
+				CalculateTemperature(RawValue);
+				status = IDLE;
 
-			if(ret_status)
+				/* Start pressure conversion */
+				if(isPressConvActivated)
+					startNewPressureConversion();
+			}
+			else if(status == PRESSURE_CONV_IN_PROGRESS)
 			{
-				ret_status = i2c_drv_ptr->writeByte(BMP180_OUT_REG_MSB_EEPROM_ADDR, BMP180_I2C_ADDR, false);
-				if(ret_status)
-				{
-					ret_status = i2c_drv_ptr->read(BMP180_I2C_ADDR, 1, &msb);
-					if(ret_status)
-					{
-						uint16_t RawValue = (msb << 8) + lsb;
-						/* Convert the value in real temperature or pressure */
-						if(status == TEMP_CONV_IN_PROGRESS)
-						{
-							CalculateTemperature(RawValue);
-							status = IDLE;
-
-							/* Start pressure conversion */
-							if(isPressConvActivated)
-								startNewPressureConversion();
-						}
-						else if(status == PRESSURE_CONV_IN_PROGRESS)
-						{
-							CalculatePressure(RawValue);
-							status = IDLE;
-						}
-					}
-					else
-						status = COMM_FAILED;
-				}
-				else
-					status = COMM_FAILED;
+				CalculatePressure(RawValue);
+				status = IDLE;
 			}
-			else
-				status = COMM_FAILED;
 		}
 		else
 			status = COMM_FAILED;
@@ -279,15 +245,17 @@ void Bmp180::CalculatePressure(uint32_t UP)
 
 }
 
-void Bmp180::Bmp180Monitoring_Task()
+void Bmp180::Bmp180Monitoring_Task(void* context)
 {
+	Bmp180* bmp180_ptr = (Bmp180*)context;
+
 	/* If the status is equal to IDLE, start a new temperature conversion */
-	if((p_global_BSW_bmp180->getStatus() == IDLE) && p_global_BSW_bmp180->isTempConversionActivated())
-		p_global_BSW_bmp180->startNewTemperatureConversion();
+	if((bmp180_ptr->getStatus() == IDLE) && bmp180_ptr->isTempConversionActivated())
+		bmp180_ptr->startNewTemperatureConversion();
 
 	/* Monitoring of temperature and pressure value */
-	p_global_BSW_bmp180->TemperatureMonitoring();
-	p_global_BSW_bmp180->PressureMonitoring();
+	bmp180_ptr->TemperatureMonitoring();
+	bmp180_ptr->PressureMonitoring();
 }
 
 void Bmp180::TemperatureMonitoring()
@@ -309,7 +277,7 @@ void Bmp180::ActivateTemperatureConversion(uint16_t req_period)
 	/* Currently task period is updated directly,
 	 * then pressure and temperature conversion have always the same period */
 	task_period = req_period;
-	p_global_scheduler->updateTaskPeriod((TaskPtr_t)(&Bmp180::Bmp180Monitoring_Task), task_period);
+	p_global_scheduler->updateTaskPeriod(monitoring_task_handle, task_period);
 }
 
 void Bmp180::ActivatePressureConversion(uint16_t req_period)
@@ -320,7 +288,7 @@ void Bmp180::ActivatePressureConversion(uint16_t req_period)
 	/* Currently task period is updated directly,
 	 * then pressure and temperature conversion have always the same period */
 	task_period = req_period;
-	p_global_scheduler->updateTaskPeriod((TaskPtr_t)(&Bmp180::Bmp180Monitoring_Task), task_period);
+	p_global_scheduler->updateTaskPeriod(monitoring_task_handle, task_period);
 }
 
 void Bmp180::StopTemperatureConversion()
@@ -24,12 +24,8 @@
 #define BMP180_TEMP_MEAS_WAITING_TIME 6 /*!< Waiting time for a temperature conversion */
 #define BMP180_PRESS_MEAS_OSS0_WAITING_TIME 15 /*!< Waiting time for a pressure conversion with parameter OSS0 */
 
-#define BMP180_TIMER_PRESCALER_VALUE 64 /*!< Value of prescaler to use for timer */
-#define BMP180_TEMP_MEAS_TIMER_CTC_VALUE ((F_CPU/BMP180_TIMER_PRESCALER_VALUE)/(1000/BMP180_TEMP_MEAS_WAITING_TIME)) /*!< Compare value for periodic timer in case of temperature conversion */
-#define BMP180_PRESS_MEAS_OSS0_TIMER_CTC_VALUE ((F_CPU/BMP180_TIMER_PRESCALER_VALUE)/(1000/BMP180_PRESS_MEAS_OSS0_WAITING_TIME)) /*!< Compare value for periodic timer in case of pressure conversion with parameter OSS0 */
-
-#define BMP180_OUT_REG_LSB_EEPROM_ADDR 0xF7 /*!< Address of LSB out register */
-#define BMP180_OUT_REG_MSB_EEPROM_ADDR 0xF6 /*!< Address of MSB out register */
+#define BMP180_OUT_REG_MSB_EEPROM_ADDR 0xF6 /*!< Address of MSB out register, followed by LSB and XLSB out registers */
+#define BMP180_OUT_REG_SIZE_OSS0 2 /*!< Number of out registers to read with parameter OSS0 (MSB and LSB), XLSB register is also needed for OSS > 0 */
 
 #define BMP180_MONITORING_DEFAULT_PERIOD 500 /*!< Monitoring period is set by default to 500ms */
 
@@ -87,13 +83,32 @@ public:
 	bool getPressureValue(uint16_t* data);
 
 	/*!
-	 * @brief End of conversion interrupt
-	 * @details This function is called by the timer interrupt at the end of the conversion. It will retrieve the
+	 * @brief End of conversion function
+	 * @details This function is called at the end of the conversion. It will retrieve the
 	 * 			raw temperature of pressure value according to the conversion type and then calculate true value.
 	 *
 	 * @return Nothing
 	 */
-	void conversionTimerInterrupt();
+	void conversionEnd();
+
+	/*!
+	 * @brief End of conversion one-shot timer function
+	 * @details This function is called by the scheduler when the conversion waiting time has elapsed. It calls the end of conversion function of the given driver.
+	 *
+	 * @param [in] arg Pointer to the BMP180 driver object
+	 * @return Nothing
+	 */
+	static void conversionEnd_callback(void* arg);
+
+	/*!
+	 * @brief Conversion start completion function
+	 * @details This function is called by the I2C driver at the end of the transmission of a conversion start command. If the transmission has failed, the driver status is set as failed.
+	 *
+	 * @param [in] context Pointer to the BMP180 driver object
+	 * @param [in] i2c_status Result of the I2C transaction
+	 * @return Nothing
+	 */
+	static void conversionStart_callback(void* context, bool i2c_status);
 
 	/*!
 	 * @brief BMP180 periodic monitoring function
@@ -103,9 +118,10 @@ public:
 	 * 			Temperature and pressure values time stamps are monitored and availability of measures are updated.
 	 * 			It also	monitors the status of the driver, if the driver is failed, it tries to restart the sensor device.
 	 *
+	 * @param [in] context Pointer to the BMP180 driver object
 	 * @return Nothing
 	 */
-	static void Bmp180Monitoring_Task();
+	static void Bmp180Monitoring_Task(void* context);
 
 	/*!
 	 * @brief Driver status get function
@@ -131,7 +147,7 @@ public:
 
 	/*!
 	 * @brief Starts a new temperature conversion
-	 * @details This function starts a new temperature conversion by writing 0x2E into register 0xF4 of sensor.
+	 * @details This function starts a new temperature conversion by writing 0x2E into register 0xF4 of sensor. The command is sent in background by the I2C driver.
 	 * 			It also starts a timer to retrieve sensor data after the conversion time.
 	 *
 	 * @return Nothing
@@ -140,7 +156,7 @@ public:
 
 	/*!
 	 * @brief Starts a new pressure conversion
-	 * @details This function starts a new pressure conversion by writing 0x74 into register 0xF4 of sensor.
+	 * @details This function starts a new pressure conversion by writing 0x74 into register 0xF4 of sensor. The command is sent in background by the I2C driver.
 	 * 			It also starts a timer to retrieve sensor data after the conversion time.
 	 *
 	 * @return Nothing
@@ -228,6 +244,7 @@ private:
 	uint8_t chip_id; /*!< Sensor chip ID */
 	T_BMP180_status status; /*!< Sensor status */
 	uint16_t task_period; /*!< Period of the monitoring task */
+	TaskHandle_t monitoring_task_handle; /*!< Handle of the monitoring task */
 	bool isTempConvActivated; /*!< Temperature conversion activation flag */
 	bool isPressConvActivated; /*!< Pressure conversion activation flag */
 
@@ -11,6 +11,9 @@
 #include <avr/wdt.h>
 
 #include "../lib/String/String.h"
+#include "../lib/StaticPool/StaticPool.h"
+
+#include "../scheduler/scheduler.h"
 
 #include "usart/usart.h"
 #include "timer/timer.h"
@@ -10,7 +10,7 @@
 #include <stdlib.h>
 #include <avr/io.h>
 
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../scheduler/scheduler.h"
 #include "../timer/timer.h"
 #include "CpuLoad.h"
@@ -37,12 +37,14 @@ CpuLoad::CpuLoad()
 		p_global_BSW_timer = new timer();
 }
 
-void CpuLoad::ComputeCPULoad()
+void CpuLoad::ComputeCPULoad(uint32_t busy_ticks, uint32_t window_ticks)
 {
-	uint16_t counter_value = p_global_BSW_timer->getTimer4Value();
+	/* Saturate busy time, a task may have been running since before the window started */
+	if(busy_ticks > window_ticks)
+		busy_ticks = window_ticks;
 
 	/* Compute current load */
-	current_load = (uint8_t)((uint32_t)(counter_value * 100) / (uint32_t)TIMER_CTC_VALUE);
+	current_load = (uint8_t)((busy_ticks * 100) / window_ticks);
 
 	if(sample_cnt < NB_OF_SAMPLES)
 		sample_cnt++;
@@ -31,12 +31,14 @@ public:
 
 	/*!
 	 * @brief Computes current CPU load
-	 * @details This function computes the current CPU load using value of the timer used by the scheduler at the end of the periodic cycle.
-	 * 			This value is divided by the PIT period to obtain CPU load;
+	 * @details This function computes the current CPU load using the time spent by the scheduler in tasks during the last measurement window.
+	 * 			This busy time is divided by the duration of the window to obtain CPU load.
 	 *
+	 * @param [in] busy_ticks Time spent in tasks during the window (in scheduler timer ticks)
+	 * @param [in] window_ticks Duration of the measurement window (in scheduler timer ticks)
 	 * @return Nothing
 	 */
-	void ComputeCPULoad();
+	void ComputeCPULoad(uint32_t busy_ticks, uint32_t window_ticks);
 
 	/*!
 	 * @brief Get current CPU load value
@@ -13,7 +13,7 @@
 #include <avr/interrupt.h>
 
 #include "../../lib/string/String.h"
-#include "../../lib/LinkedList/LinkedList.h"
+#include "../../lib/StaticPool/StaticPool.h"
 #include "../../scheduler/scheduler.h"
 
 #include "../usart/usart.h"
@@ -31,22 +31,42 @@
 
 /*!
  * @brief Main software interrupt
- * @details This function handles the interrupt raised by Timer #4. It wakes up the software every 500 ms to perform applications.
+ * @details This function handles the compare interrupt raised by Timer #4. It releases the tasks at their deadline, the tasks are launched by the background loop.
  * @return Nothing
  */
 ISR(TIMER4_COMPA_vect)
 {
-	p_global_scheduler->launchPeriodicTasks();
+	p_global_scheduler->releasePeriodicTasks();
 }
 
 /*!
- * @brief Bmp180 end of conversion interrupt
- * @details This function calls the end of conversion function of BMP180 driver.
+ * @brief Scheduler time base interrupt
+ * @details This function handles the overflow interrupt raised by Timer #4. It extends the scheduler time base.
  * @return Nothing
  */
-ISR(TIMER3_COMPA_vect)
+ISR(TIMER4_OVF_vect)
 {
-	p_global_BSW_bmp180->conversionTimerInterrupt();
+	p_global_scheduler->timerOverflowInterrupt();
+}
+
+/*!
+ * @brief Scheduler one-shot timer interrupt
+ * @details This function calls the one-shot timer expiry function of the scheduler.
+ * @return Nothing
+ */
+ISR(TIMER4_COMPB_vect)
+{
+	p_global_scheduler->oneShotInterrupt();
+}
+
+/*!
+ * @brief I2C bus interrupt
+ * @details This function calls the state machine of the I2C driver.
+ * @return Nothing
+ */
+ISR(TWI_vect)
+{
+	p_global_BSW_i2c->interruptHandler();
 }
 
 /*!
@@ -62,31 +82,24 @@ ISR(TIMER1_COMPA_vect)
 
 /*!
  * @brief USART Rx Complete interrupt
- * @details This function handles the interrupt raised when a frame has been received by USART. If debug mode mode is active, it calls debug mode management function.
- * 			If inactive, it calls debug mode activation function if the received character is 'a'
+ * @details This function handles the interrupt raised when a frame has been received by USART. The received byte is pushed in the reception buffer and,
+ * 			if debug mode is active, the debug received data management task is activated. The debug menu is then managed in background.
  * @return Nothing
  */
 ISR(USART0_RX_vect)
 {
-	bool quit = false;
+	p_global_BSW_usart->usart_rxInterrupt();
 
 	if(isDebugModeActivated)
-	{
-		/* If the debug mode is started */
-		if(p_global_ASW_DebugManagement != 0)
-		{
-			quit = p_global_ASW_DebugManagement->DebugModeManagement();
-		}
-		else if(p_global_ASW_DebugInterface->read() == 'a')
-		{
-			p_global_ASW_DebugManagement = new DebugManagement();
-		}
-
-		if(quit)
-		{
-			free(p_global_ASW_DebugManagement);
-			p_global_ASW_DebugManagement = 0;
-		}
-	}
+		p_global_scheduler->activateTask(DebugManagement::rx_task_handle);
+}
 
+/*!
+ * @brief USART Data Register Empty interrupt
+ * @details This function handles the interrupt raised when the transmission data register of USART is empty. The next byte of the transmission buffer is sent.
+ * @return Nothing
+ */
+ISR(USART0_UDRE_vect)
+{
+	p_global_BSW_usart->usart_txInterrupt();
 }
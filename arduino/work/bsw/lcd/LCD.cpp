@@ -9,6 +9,10 @@
 
 #include <util/delay.h>
 #include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "../../lib/StaticPool/StaticPool.h"
+#include "../../scheduler/scheduler.h"
 
 #include "../I2C/I2C.h"
 #include "LCD.h"
@@ -19,6 +23,12 @@ LCD::LCD(const T_LCD_conf_struct* init_conf)
 {
 	/* Initialize class variables */
 	ddram_addr = 0;
+	tx_buffer_idx = 0;
+	tx_buffer_busy_nb = 0;
+	isTxError = false;
+	isReady = false;
+	cmd_queue_head = 0;
+	cmd_queue_count = 0;
 
 	/* Create new instance of I2C driver if needed */
 	if(p_global_BSW_i2c == 0)
@@ -42,115 +52,135 @@ LCD::LCD(const T_LCD_conf_struct* init_conf)
 }
 
 
-void LCD::write4bits(uint8_t data)
+bool LCD::sendBytes(uint8_t* data, uint8_t size, I2CCallback_t callback)
 {
-	uint8_t dummy;
+	/* If the queue is full, wait for the end of the queued transactions and try again */
+	if(!i2c_drv_ptr->writeAsync(data, cnfI2C_addr, size, callback, this))
+	{
+		i2c_drv_ptr->flush();
+		return i2c_drv_ptr->writeAsync(data, cnfI2C_addr, size, callback, this);
+	}
+
+	return true;
+}
 
+void LCD::encodeNibble(uint8_t* buf, uint8_t data)
+{
 	/* Configure backlight pin and set EN pin */
 	data |= (backlight_enable << BACKLIGHT_PIN) + (1 << EN_PIN);
-	dummy = i2c_drv_ptr->writeByte(data, cnfI2C_addr, true);
-
-	_delay_us(1);
+	buf[0] = data;
 
 	/* Clear enable pin */
-	data &= ~(1 << EN_PIN);
-	dummy = i2c_drv_ptr->writeByte(data, cnfI2C_addr, true);
+	buf[1] = data & ~(1 << EN_PIN);
+}
+
+void LCD::write4bits(uint8_t data, I2CCallback_t callback)
+{
+	uint8_t buf[LCD_I2C_BYTES_PER_NIBBLE];
 
-	_delay_us(50);
+	/* The EN pulse lasts for the transmission of one byte */
+	encodeNibble(buf, data);
+
+	/* If the nibble can not be queued, the callback is called as for a failed transmission so that a long command does not block the screen */
+	if(!sendBytes(buf, LCD_I2C_BYTES_PER_NIBBLE, callback) && (callback != 0))
+		callback(this, false);
 }
 
-void LCD::write(uint8_t data, T_LCD_config_mode mode)
+void LCD::write(uint8_t data, T_LCD_config_mode mode, I2CCallback_t callback)
 {
 	uint8_t high = data & 0b11110000;
 	uint8_t low = (data << 4) & 0b11110000;
 
 	write4bits(high | (mode << RS_PIN));
-	write4bits(low | (mode << RS_PIN));
+	write4bits(low | (mode << RS_PIN), callback);
 }
 
 
 void LCD::InitializeScreen()
 {
-	uint8_t data;
+	/*
+	 * The configuration commands are queued, they will be sent once the screen is in 4-bits mode
+	 */
 
-	/* Wait for 30ms after power on */
-	_delay_us(30000);
+	/* Configure line and matrix */
+	command(LCD_CMD_FUNCTION_SET);
+
+	/* Configure display */
+	command(LCD_CMD_DISPLAY_CTRL);
+
+	/* Clear display */
+	command(LCD_CMD_CLEAR_DISPLAY);
+
+	/* Configure cursor */
+	command(LCD_CMD_ENTRY_MODE_SET);
+
+	/* Wait for 30ms after power on, the wait is only blocking if no timer is available */
+	if(!p_global_scheduler->scheduleOnce(&LCD::powerOn_callback, LCD_WAIT_POWER_ON_MS, this))
+	{
+		_delay_ms(LCD_WAIT_POWER_ON_MS);
+		Start4bitsMode();
+	}
+}
+
+void LCD::powerOn_callback(void* arg)
+{
+	((LCD*)arg)->Start4bitsMode();
+}
+
+void LCD::Start4bitsMode()
+{
+	uint8_t data;
 
 	/*
 	 * Before screen is configured in 4-bits mode, the function LCD::command cannot be used. Then we build manually the data word and send it with LCD::write4bits function
+	 * The transmission of each nibble lasts longer than the 38 us needed by the screen, then no waiting time is added
 	 */
 
 	/* Function set, first go in 8-bits mode 3 times, to avoid any screen issue */
 	data = (1 << LCD_INST_FUNCTION_SET) + (1 << LCD_FCT_SET_FIELD_DL);
 	write4bits(data);
-
-	/* Wait at least 38 us */
-	_delay_us(40);
-
-	data = (1 << LCD_INST_FUNCTION_SET) + (1 << LCD_FCT_SET_FIELD_DL);
 	write4bits(data);
-
-	/* Wait at least 38 us */
-	_delay_us(40);
-
-	data = (1 << LCD_INST_FUNCTION_SET) + (1 << LCD_FCT_SET_FIELD_DL);
 	write4bits(data);
 
-	/* Wait at least 38 us */
-	_delay_us(40);
-
 	/* Function set, go in 4-bits mode */
 	data = (1 << LCD_INST_FUNCTION_SET);
 	write4bits(data);
 
-	/* Wait at least 38 us */
-	_delay_us(40);
-
-	/* Configure line and matrix */
-	command(LCD_CMD_FUNCTION_SET);
-
-	/* Configure display */
-	command(LCD_CMD_DISPLAY_CTRL);
-
-	/* Clear display */
-	command(LCD_CMD_CLEAR_DISPLAY);
-
-	/* Configure cursor */
-	command(LCD_CMD_ENTRY_MODE_SET);
+	/* Now send the configuration commands */
+	isReady = true;
+	processCommands();
 }
 
-void LCD::command(T_LCD_command cmd)
+bool LCD::command(T_LCD_command cmd)
 {
 	uint8_t data = 0;
-	uint32_t wait_time = 0;
+	bool isLongCmd = false;
+	uint8_t sreg;
+	uint8_t idx;
 
 	switch(cmd)
 	{
 	case LCD_CMD_FUNCTION_SET:
 		/* Data length bit is forced to 0, we can work only in 4-bits mode */
 		data = (1 << LCD_INST_FUNCTION_SET) + (cnfLineNumber << LCD_FCT_SET_FIELD_N) + (cnfFontType << LCD_FCT_SET_FIELD_F);
-		wait_time = LCD_WAIT_OTHER_MODES;
 		break;
 
 	case LCD_CMD_DISPLAY_CTRL:
 		data = (1 << LCD_INST_DISPLAY_CTRL) + (cnfDisplayOnOff << LCD_DISPLAY_CTRL_FIELD_D) + (cnfCursorOnOff << LCD_DISPLAY_CTRL_FIELD_C) + (cnfCursorBlink << LCD_DISPLAY_CTRL_FIELD_B);
-		wait_time = LCD_WAIT_OTHER_MODES;
 		break;
 
 	case LCD_CMD_CLEAR_DISPLAY:
 		data = (1 << LCD_INST_CLR_DISPLAY_BIT);
 		ddram_addr = 0;
-		wait_time = LCD_WAIT_CLR_RETURN;
+		isLongCmd = true;
 		break;
 
 	case LCD_CMD_ENTRY_MODE_SET:
 		data = (1 << LCD_INST_ENTRY_MODE_SET) + (cnfEntryModeDir << LCD_CNF_SHIFT_ID) + (cnfEntryModeShift << LCD_CNF_SHIFT_SH);
-		wait_time = LCD_WAIT_OTHER_MODES;
 		break;
 
 	case LCD_CMD_SET_DDRAM_ADDR:
 		data = (1 << LCD_INST_SET_DDRAM_ADDR) + ddram_addr;
-		wait_time = LCD_WAIT_OTHER_MODES;
 		break;
 
 	default:
@@ -158,11 +188,85 @@ void LCD::command(T_LCD_command cmd)
 		break;
 	}
 
-	write(data, LCD_MODE_INSTRUCTION);
-	_delay_us(wait_time);
+	/* The command word is built now as it depends on the current configuration, it is sent when the screen is ready */
+	sreg = SREG;
+	cli();
+
+	if(cmd_queue_count >= LCD_CMD_QUEUE_SIZE)
+	{
+		SREG = sreg;
+		return false;
+	}
+
+	idx = (cmd_queue_head + cmd_queue_count) % LCD_CMD_QUEUE_SIZE;
+	cmd_queue[idx].data = data;
+	cmd_queue[idx].isLongCmd = isLongCmd;
+	cmd_queue_count++;
+
+	SREG = sreg;
+
+	processCommands();
+
+	return true;
+}
+
+void LCD::processCommands()
+{
+	T_LCD_queued_cmd cmd;
+	uint8_t sreg;
+
+	while(true)
+	{
+		sreg = SREG;
+		cli();
+
+		if(!isReady || (cmd_queue_count == 0))
+		{
+			SREG = sreg;
+			return;
+		}
+
+		cmd = cmd_queue[cmd_queue_head];
+		cmd_queue_head = (cmd_queue_head + 1) % LCD_CMD_QUEUE_SIZE;
+		cmd_queue_count--;
+
+		/* After a long command, the screen is busy until the end of its execution */
+		if(cmd.isLongCmd)
+			isReady = false;
+
+		SREG = sreg;
+
+		if(cmd.isLongCmd)
+			write(cmd.data, LCD_MODE_INSTRUCTION, &LCD::longCommandSent_callback);
+		else
+			write(cmd.data, LCD_MODE_INSTRUCTION);
+	}
+}
+
+void LCD::longCommandSent_callback(void* context, bool status)
+{
+	/* The execution time starts when the command has been received by the screen.
+	 * If no timer is available, the screen is set ready immediately : the queued commands will be sent at the next command request */
+	if(!p_global_scheduler->scheduleOnce(&LCD::screenReady_callback, LCD_WAIT_CLR_RETURN_MS, context))
+		((LCD*)context)->isReady = true;
+}
+
+void LCD::screenReady_callback(void* arg)
+{
+	LCD* lcd_ptr = (LCD*)arg;
+
+	lcd_ptr->isReady = true;
+	lcd_ptr->processCommands();
 }
 
 void LCD::SetDDRAMAddress(uint8_t addr)
+{
+	/* Set the internal variable and update screen */
+	ddram_addr = checkDDRAMAddress(addr);
+	command(LCD_CMD_SET_DDRAM_ADDR);
+}
+
+uint8_t LCD::checkDDRAMAddress(uint8_t addr)
 {
 	/* If 1-line mode, address shall be between 0 and 0x4F */
 	if (cnfLineNumber == LCD_CNF_ONE_LINE)
@@ -179,33 +283,149 @@ void LCD::SetDDRAMAddress(uint8_t addr)
 			addr = LCD_RAM_2_LINES_MAX_2;
 	}
 
-	/* Now set the internal variable and update screen */
-	ddram_addr = addr;
-	command(LCD_CMD_SET_DDRAM_ADDR);
+	return addr;
 }
 
 void LCD::WriteInRam(uint8_t a_char, T_LCD_ram_area area)
 {
-
-	/* Only DDRAM is implemented for now */
+	/* Only the DDRAM address is memorized : in CGRAM the byte is written at the address set by the last set CGRAM address instruction, custom characters are written by WriteGlyph */
 	if (area == LCD_DATA_DDRAM)
+		incrementDDRAMAddress();
+
+	write(a_char, LCD_MODE_DATA);
+}
+
+bool LCD::WriteString(uint8_t* str, uint8_t size)
+{
+	return sendString(str, size, false);
+}
+
+bool LCD::WriteStringAt(uint8_t addr, uint8_t* str, uint8_t size)
+{
+	ddram_addr = checkDDRAMAddress(addr);
+	return sendString(str, size, true);
+}
+
+bool LCD::sendString(uint8_t* str, uint8_t size, bool isAddrCmdNeeded)
+{
+	uint8_t* buf_ptr = getTxBuffer();
+
+	if(size > LCD_SIZE_NB_CHAR_PER_LINE)
+		size = LCD_SIZE_NB_CHAR_PER_LINE;
+
+	/* The set DDRAM address instruction is encoded at the start of the buffer, the screen executes it during the transmission of the first character */
+	if(isAddrCmdNeeded)
+		buf_ptr = encodeByte(buf_ptr, (1 << LCD_INST_SET_DDRAM_ADDR) + ddram_addr, LCD_MODE_INSTRUCTION);
+
+	/* Encode each character in data mode */
+	for(uint8_t i = 0; i < size; i++)
 	{
-		/* Increment RAM address */
-		if (cnfLineNumber == LCD_CNF_ONE_LINE)
-			ddram_addr = (ddram_addr + 1) % (LCD_RAM_1_LINE_MAX + 1);
+		buf_ptr = encodeByte(buf_ptr, str[i], LCD_MODE_DATA);
+		incrementDDRAMAddress();
+	}
 
-		else if (cnfLineNumber == LCD_CNF_TWO_LINE)
-		{
-			ddram_addr++;
+	return sendTxBuffer(buf_ptr);
+}
 
-			if (ddram_addr == (LCD_RAM_2_LINES_MAX_1 + 1))
-				ddram_addr = LCD_RAM_2_LINES_MIN_2;
+bool LCD::WriteGlyph(uint8_t slot, const uint8_t* bitmap)
+{
+	uint8_t* buf_ptr;
 
-			else if (ddram_addr == (LCD_RAM_2_LINES_MAX_2 + 1))
-				ddram_addr = LCD_RAM_2_LINES_MIN_1;
-		}
+	if(slot >= LCD_CGRAM_SLOT_NB)
+		return false;
+
+	buf_ptr = getTxBuffer();
+
+	/* Set CGRAM address to the first row of the slot, the address is incremented by the screen after each row */
+	buf_ptr = encodeByte(buf_ptr, (1 << LCD_INST_SET_CGRAM_ADDR) + (slot * LCD_CGRAM_GLYPH_SIZE), LCD_MODE_INSTRUCTION);
+
+	for(uint8_t i = 0; i < LCD_CGRAM_GLYPH_SIZE; i++)
+		buf_ptr = encodeByte(buf_ptr, bitmap[i], LCD_MODE_DATA);
+
+	/* Go back to DDRAM at the memorized address, so that the next characters are written on the screen */
+	buf_ptr = encodeByte(buf_ptr, (1 << LCD_INST_SET_DDRAM_ADDR) + ddram_addr, LCD_MODE_INSTRUCTION);
+
+	return sendTxBuffer(buf_ptr);
+}
+
+bool LCD::ReadTxError()
+{
+	bool result;
+	uint8_t sreg = SREG;
+
+	/* The flag is also set by the I2C interrupt */
+	cli();
+	result = isTxError;
+	isTxError = false;
+	SREG = sreg;
+
+	return result;
+}
+
+uint8_t* LCD::getTxBuffer()
+{
+	/* Wait for the end of the oldest string transmission if all the buffers are used */
+	if(!IsTxBufferAvailable())
+		i2c_drv_ptr->flush();
+
+	return tx_buffer[tx_buffer_idx];
+}
+
+bool LCD::sendTxBuffer(uint8_t* buf_end)
+{
+	uint8_t* buf = tx_buffer[tx_buffer_idx];
+	uint8_t sreg = SREG;
+
+	/* The counter is also decremented by the I2C interrupt */
+	cli();
+	tx_buffer_busy_nb++;
+	SREG = sreg;
+
+	/* If the string can not be queued, the buffer is released and will be reused for the next string */
+	if(sendBytes(buf, buf_end - buf, &LCD::stringSent_callback))
+	{
+		tx_buffer_idx = (tx_buffer_idx + 1) % LCD_TX_BUFFER_NB;
+		return true;
+	}
+	else
+	{
+		cli();
+		tx_buffer_busy_nb--;
+		SREG = sreg;
+		return false;
 	}
+}
 
-	write(a_char, LCD_MODE_DATA);
-	_delay_us(LCD_WAIT_OTHER_MODES);
+uint8_t* LCD::encodeByte(uint8_t* buf, uint8_t data, T_LCD_config_mode mode)
+{
+	encodeNibble(buf, (data & 0b11110000) | (mode << RS_PIN));
+	encodeNibble(buf + LCD_I2C_BYTES_PER_NIBBLE, ((data << 4) & 0b11110000) | (mode << RS_PIN));
+
+	return buf + LCD_I2C_BYTES_PER_CHAR;
+}
+
+void LCD::stringSent_callback(void* context, bool status)
+{
+	/* The I2C transactions end in the order they are queued : the released buffer is always the oldest one */
+	((LCD*)context)->tx_buffer_busy_nb--;
+
+	if(!status)
+		((LCD*)context)->isTxError = true;
+}
+
+void LCD::incrementDDRAMAddress()
+{
+	if (cnfLineNumber == LCD_CNF_ONE_LINE)
+		ddram_addr = (ddram_addr + 1) % (LCD_RAM_1_LINE_MAX + 1);
+
+	else if (cnfLineNumber == LCD_CNF_TWO_LINE)
+	{
+		ddram_addr++;
+
+		if (ddram_addr == (LCD_RAM_2_LINES_MAX_1 + 1))
+			ddram_addr = LCD_RAM_2_LINES_MIN_2;
+
+		else if (ddram_addr == (LCD_RAM_2_LINES_MAX_2 + 1))
+			ddram_addr = LCD_RAM_2_LINES_MIN_1;
+	}
 }
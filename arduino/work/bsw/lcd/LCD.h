@@ -22,6 +22,7 @@
 #define LCD_INST_DISPLAY_CTRL 3 /*!< Instruction bit for "display control" is DB3 */
 #define LCD_INST_ENTRY_MODE_SET 2 /*!< Instruction bit for "entry mode" is DB2 */
 #define LCD_INST_SET_DDRAM_ADDR 7 /*!< Instruction bit for "set DDRAM address" is DB7 */
+#define LCD_INST_SET_CGRAM_ADDR 6 /*!< Instruction bit for "set CGRAM address" is DB6 */
 
 /* Definition of fields for function set command */
 #define LCD_FCT_SET_FIELD_DL 4 /*!< Field DL (data length) of command "function set" is on bit DB4 */
@@ -77,14 +78,26 @@
 #define LCD_RAM_2_LINES_MIN_2 0x40 /*!< Minimum address value in 2-lines mode for line 2 */
 #define LCD_RAM_2_LINES_MAX_2 0x67 /*!< Maximum address value in 2-lines mode for line 2 */
 
-/* Definition of waiting times after screen operations in us */
-#define LCD_WAIT_CLR_RETURN 1600 /*!< Waiting time after clear display and return home operations is at least 1520 us */
-#define LCD_WAIT_OTHER_MODES 40 /*!< Waiting time after all other modes is at least 38 us */
+/* Definition of waiting times after screen operations */
+#define LCD_WAIT_POWER_ON_MS 30 /*!< Waiting time after power on before the screen configuration is at least 30 ms */
+#define LCD_WAIT_CLR_RETURN_MS 2 /*!< Waiting time after clear display and return home operations is at least 1520 us */
+
+#define LCD_CMD_QUEUE_SIZE 8 /*!< Maximum number of commands waiting for the screen to be ready */
 
 /* Definition of screen sizes */
 #define LCD_SIZE_NB_CHAR_PER_LINE 20 /*!< LCD screen has 20 characters per line */
 #define LCD_SIZE_NB_LINES 4 /*!< LCD screen has 4 lines */
 
+/* Definition of custom characters */
+#define LCD_CGRAM_SLOT_NB 8 /*!< CGRAM contains 8 custom characters in 5*8 dots font */
+#define LCD_CGRAM_GLYPH_SIZE 8 /*!< A custom character is defined by 8 rows, bits 0-4 of each row are the dots from right to left */
+#define LCD_CGRAM_CHAR_CODE(slot) (0x08 + (slot)) /*!< Character code displaying a CGRAM slot : codes 0x08-0x0F are mirrors of codes 0x00-0x07 and avoid the null character */
+#define LCD_CHAR_FULL_BLOCK 0xFF /*!< Character code of the full block in character generator ROM */
+
+#define LCD_I2C_BYTES_PER_NIBBLE 2 /*!< Number of I2C expander bytes needed to send a nibble : EN pin set, then EN pin clear */
+#define LCD_I2C_BYTES_PER_CHAR (2 * LCD_I2C_BYTES_PER_NIBBLE) /*!< Number of I2C expander bytes needed to send a character in 4-bits mode */
+#define LCD_TX_BUFFER_NB 2 /*!< Number of string buffers : a string can be encoded while the previous one is being sent */
+
 
 /*!
  * @brief LCD commands enumeration
@@ -100,6 +113,17 @@ typedef enum
 }
 T_LCD_command;
 
+/*!
+ * @brief Structure defining a queued command
+ * @details The command word is built when the command is requested, it is sent when the screen is ready.
+ */
+typedef struct
+{
+	uint8_t data; /*!< 8-bit command word */
+	bool isLongCmd; /*!< Flag indicating that the screen is busy during LCD_WAIT_CLR_RETURN_MS after the command */
+}
+T_LCD_queued_cmd;
+
 /*!
  * @brief LCD modes enumeration
  * @details This enumeration defines the possible modes for communication with LCD. Two modes are possible, DATA for writing data in RAM and INSTRUCTION for configuring the display
@@ -161,12 +185,36 @@ public:
 
 	/*!
 	 * @brief LCD command management function
-	 * @details This function sends the requested command to the LCD screen. It builds the 8-bit command word and sends it on I2C bus.
+	 * @details This function builds the 8-bit command word of the requested command and queues it. The queued commands are sent on I2C bus as soon as the screen is ready,
+	 * 			the function never waits for the execution of the command : the end of the clear display operation is signaled by a one-shot timer.
 	 *
 	 * @param [in] cmd Requested command
-	 * @return Nothing
+	 * @return True if the command has been queued, false if the queue is full
+	 */
+	bool command(T_LCD_command cmd);
+
+	/*!
+	 * @brief Screen ready get function
+	 * @details This function answers if the screen can receive characters : the initialization is done and no long command is being executed.
+	 * 			The characters written while the screen is not ready may be lost.
+	 *
+	 * @return True if the screen is ready, false otherwise
 	 */
-	void command(T_LCD_command cmd);
+	inline bool IsReady()
+	{
+		return isReady;
+	}
+
+	/*!
+	 * @brief String buffer availability get function
+	 * @details This function answers if a string buffer is free. If no buffer is free, the next string or glyph writing waits for the end of the queued I2C transactions.
+	 *
+	 * @return True if a string buffer is free, false otherwise
+	 */
+	inline bool IsTxBufferAvailable()
+	{
+		return (tx_buffer_busy_nb < LCD_TX_BUFFER_NB);
+	}
 
 	/*!
 	 * @brief Backlight configuration function
@@ -299,7 +347,7 @@ public:
 	/*!
 	 * @brief Screen RAM write function
 	 * @details This function writes in the memorized RAM address the character given as parameter. After a write the screen automatically increment/decrement the RAM address, so we do the same in the function to stay coherent.
-	 * 			Currently only DDRAM write is implemented.
+	 * 			Only the DDRAM address is memorized : a write in CGRAM does not change it. A complete custom character shall be written with WriteGlyph function, which sets the CGRAM address.
 	 *
 	 * 	@param [in] a_char Data byte to write in RAM
 	 * 	@param [in] area Area in RAM where the data will be written : DDRAM or CGRAM
@@ -307,6 +355,50 @@ public:
 	 */
 	void WriteInRam(uint8_t a_char, T_LCD_ram_area area);
 
+	/*!
+	 * @brief Screen RAM string write function
+	 * @details This function writes the given characters in DDRAM from the memorized address. The I2C expander bytes of all the characters are sent in a single I2C transaction,
+	 * 			the function returns without waiting for the end of the transmission. The screen executes each character during the transmission of the next one, then no waiting time is needed.
+	 *
+	 * 	@param [in] str Pointer to the characters to write
+	 * 	@param [in] size Number of characters to write, limited to LCD_SIZE_NB_CHAR_PER_LINE
+	 * 	@return True if the characters are queued for transmission, false otherwise
+	 */
+	bool WriteString(uint8_t* str, uint8_t size);
+
+	/*!
+	 * @brief Screen RAM string write function with address setting
+	 * @details This function sets the DDRAM address and writes the given characters from this address. The set DDRAM address instruction and the characters are sent in the same I2C transaction,
+	 * 			which saves the transaction needed by SetDDRAMAddress function. The function returns without waiting for the end of the transmission.
+	 *
+	 * 	@param [in] addr DDRAM address of the first character, checked against limits
+	 * 	@param [in] str Pointer to the characters to write
+	 * 	@param [in] size Number of characters to write, limited to LCD_SIZE_NB_CHAR_PER_LINE
+	 * 	@return True if the characters are queued for transmission, false otherwise
+	 */
+	bool WriteStringAt(uint8_t addr, uint8_t* str, uint8_t size);
+
+	/*!
+	 * @brief Custom character write function
+	 * @details This function writes the bitmap of a custom character in the requested CGRAM slot. The set CGRAM address instruction, the rows of the bitmap and
+	 * 			the set DDRAM address instruction restoring the memorized address are sent in a single I2C transaction. The function returns without waiting for the end of the transmission.
+	 * 			The characters already displayed using this slot are updated by the screen.
+	 *
+	 * 	@param [in] slot CGRAM slot, between 0 and LCD_CGRAM_SLOT_NB - 1
+	 * 	@param [in] bitmap Pointer to the LCD_CGRAM_GLYPH_SIZE rows of the character
+	 * 	@return True if the character is queued for transmission, false otherwise
+	 */
+	bool WriteGlyph(uint8_t slot, const uint8_t* bitmap);
+
+	/*!
+	 * @brief Transmission error reading function
+	 * @details This function answers if the transmission of a string or a custom character has failed since the last call, and clears the error.
+	 * 			The writing functions only report the errors occurring while queuing the transmission, the content of the screen is unknown after a failed transmission.
+	 *
+	 * @return True if a transmission has failed, false otherwise
+	 */
+	bool ReadTxError();
+
 	/*!
 	 * @brief Number of line get function
 	 * @details This function returns the line number configuration of the screen : 1 or 2 lines mode.
@@ -335,15 +427,162 @@ private:
 
 	uint8_t ddram_addr; /*!< Screen DDRAM address */
 
+	uint8_t tx_buffer[LCD_TX_BUFFER_NB][(LCD_SIZE_NB_CHAR_PER_LINE + 1) * LCD_I2C_BYTES_PER_CHAR]; /*!< I2C expander bytes of the strings being sent, including an optional set DDRAM address instruction */
+	uint8_t tx_buffer_idx; /*!< Index of the next string buffer to fill */
+	volatile uint8_t tx_buffer_busy_nb; /*!< Number of string buffers whose transmission is not finished, the buffers are released in the order they are sent */
+	volatile bool isTxError; /*!< Flag indicating that the transmission of a string buffer has failed */
+
+	volatile bool isReady; /*!< Flag indicating that the screen is initialized and does not execute a long command */
+	T_LCD_queued_cmd cmd_queue[LCD_CMD_QUEUE_SIZE]; /*!< Commands waiting for the screen to be ready */
+	uint8_t cmd_queue_head; /*!< Index of the oldest queued command */
+	uint8_t cmd_queue_count; /*!< Number of queued commands */
+
+	/*!
+	 * @brief I2C bytes sending function
+	 * @details This function queues the given bytes for the I2C expander of the screen and returns without waiting for the transmission.
+	 * 			If the I2C queue is full, the function waits until the queued transactions are done and tries again.
+	 *
+	 * 	@param [in] data Pointer to the bytes to send, they shall stay valid until the end of the transmission if size is greater than I2C_TX_INLINE_SIZE
+	 * 	@param [in] size Number of bytes to send
+	 * 	@param [in] callback Function called at the end of the transmission, can be 0. It is not called if the bytes can not be queued.
+	 * 	@return True if the bytes are queued, false otherwise
+	 */
+	bool sendBytes(uint8_t* data, uint8_t size, I2CCallback_t callback);
+
+	/*!
+	 * @brief Nibble encoding function
+	 * @details This function writes in the buffer the two I2C expander bytes of a nibble : the first one with EN pin set, the second one with EN pin clear. The backlight pin is set according to the configuration.
+	 *
+	 * 	@param [out] buf Pointer to the buffer, LCD_I2C_BYTES_PER_NIBBLE bytes are written
+	 * 	@param [in] data 8-bit data containing the nibble in bits 4-7, and the RS and RW pins
+	 * 	@return Nothing
+	 */
+	void encodeNibble(uint8_t* buf, uint8_t data);
+
+	/*!
+	 * @brief Byte encoding function
+	 * @details This function writes in the buffer the I2C expander bytes of the high and low nibbles of the given byte.
+	 *
+	 * 	@param [out] buf Pointer to the buffer, LCD_I2C_BYTES_PER_CHAR bytes are written
+	 * 	@param [in] data Instruction or character to encode
+	 * 	@param [in] mode Requested mode for LCD communication
+	 * 	@return Pointer to the buffer position following the encoded byte
+	 */
+	uint8_t* encodeByte(uint8_t* buf, uint8_t data, T_LCD_config_mode mode);
+
+	/*!
+	 * @brief DDRAM address increment function
+	 * @details This function updates the memorized DDRAM address after a character write, as done by the screen.
+	 *
+	 * 	@return Nothing
+	 */
+	void incrementDDRAMAddress();
+
+	/*!
+	 * @brief DDRAM address checking function
+	 * @details This function checks the given DDRAM address against the limits of the current line configuration and saturates it if needed.
+	 *
+	 * 	@param [in] addr Requested DDRAM address
+	 * 	@return Valid DDRAM address
+	 */
+	uint8_t checkDDRAMAddress(uint8_t addr);
+
+	/*!
+	 * @brief String encoding and sending function
+	 * @details This function encodes the given characters in the string buffer and sends them in a single I2C transaction.
+	 * 			If requested, the set DDRAM address instruction with the memorized address is encoded before the characters. \n
+	 * 			No waiting time is inserted between two characters : the execution time of an instruction other than clear display and return home is at least 38 us,
+	 * 			which is shorter than the I2C transmission of a nibble (2 bytes and the address, 270 us at 100 kHz).
+	 *
+	 * 	@param [in] str Pointer to the characters to write
+	 * 	@param [in] size Number of characters to write, limited to LCD_SIZE_NB_CHAR_PER_LINE
+	 * 	@param [in] isAddrCmdNeeded True if the set DDRAM address instruction shall be sent before the characters
+	 * 	@return True if the characters are queued for transmission, false otherwise
+	 */
+	bool sendString(uint8_t* str, uint8_t size, bool isAddrCmdNeeded);
+
+	/*!
+	 * @brief String buffer getting function
+	 * @details This function returns the next string buffer to fill. If all the buffers are being sent, it waits for the end of the queued I2C transactions.
+	 *
+	 * 	@return Pointer to the string buffer
+	 */
+	uint8_t* getTxBuffer();
+
+	/*!
+	 * @brief String buffer sending function
+	 * @details This function sends the string buffer returned by getTxBuffer and switches to the next buffer.
+	 *
+	 * 	@param [in] buf_end Pointer to the end of the encoded bytes in the string buffer
+	 * 	@return True if the string buffer is queued for transmission, false otherwise
+	 */
+	bool sendTxBuffer(uint8_t* buf_end);
+
+	/*!
+	 * @brief String transmission end function
+	 * @details This function is called by the I2C driver at the end of the string transmission, it releases the string buffer and memorizes a failed transmission.
+	 *
+	 * 	@param [in] context Pointer to the LCD object
+	 * 	@param [in] status Result of the transmission
+	 * 	@return Nothing
+	 */
+	static void stringSent_callback(void* context, bool status);
+
+	/*!
+	 * @brief Command queue processing function
+	 * @details This function sends the queued commands while the screen is ready. After a long command the screen becomes busy and the remaining commands stay in the queue.
+	 *
+	 * 	@return Nothing
+	 */
+	void processCommands();
+
+	/*!
+	 * @brief Long command transmission end function
+	 * @details This function is called by the I2C driver at the end of the transmission of a long command.
+	 * 			It starts a one-shot timer of LCD_WAIT_CLR_RETURN_MS, the screen becomes ready at the expiration of the timer.
+	 *
+	 * 	@param [in] context Pointer to the LCD object
+	 * 	@param [in] status Result of the transmission
+	 * 	@return Nothing
+	 */
+	static void longCommandSent_callback(void* context, bool status);
+
+	/*!
+	 * @brief Screen ready function
+	 * @details This function is called by the scheduler at the end of the execution time of a long command. It sets the screen as ready and sends the queued commands.
+	 *
+	 * 	@param [in] arg Pointer to the LCD object
+	 * 	@return Nothing
+	 */
+	static void screenReady_callback(void* arg);
+
+	/*!
+	 * @brief Power on waiting end function
+	 * @details This function is called by the scheduler LCD_WAIT_POWER_ON_MS after the creation of the driver. It configures the screen in 4-bits mode and sends the queued configuration commands.
+	 *
+	 * 	@param [in] arg Pointer to the LCD object
+	 * 	@return Nothing
+	 */
+	static void powerOn_callback(void* arg);
+
+	/*!
+	 * @brief 4-bits mode configuration function
+	 * @details This function sends the function set instructions configuring the screen in 4-bits mode. Then the screen is ready and the queued commands are sent.
+	 *
+	 * 	@return Nothing
+	 */
+	void Start4bitsMode();
+
 	/*!
 	 * @brief I2C write function for 4-bits mode
 	 * @details This function sends the requested 8-bits data on the I2C bus. The backlight pin is also set/clear according to the configuration.
-	 * 			The function sends the data a first time with EN pin set, then a second time with EN bit clear.
+	 * 			The data is sent a first time with EN pin set, then a second time with EN bit clear, in a single I2C transaction.
 	 *
 	 * 	@param [in] data 8-bit data to send
+	 * 	@param [in] callback Function called at the end of the transmission, can be 0
 	 * 	@return Nothing
 	 */
-	void write4bits(uint8_t data);
+	void write4bits(uint8_t data, I2CCallback_t callback = 0);
 
 	/*!
 	 * @brief I2C write function
@@ -352,14 +591,16 @@ private:
 	 *
 	 * @param [in] data 8-bit data for D0-7 pins of screen
 	 * @param [in] mode Requested mode for LCD communication
+	 * @param [in] callback Function called at the end of the transmission of the second nibble, can be 0
 	 *
 	 * @return Nothing
 	 */
-	void write(uint8_t data, T_LCD_config_mode mode);
+	void write(uint8_t data, T_LCD_config_mode mode, I2CCallback_t callback = 0);
 
 	/*!
 	 * @brief Screen configuration function.
 	 * @details This function configures the LCD screen. It's must be called during initialization phase, or the screen won't be usable. The configuration process is described in LCD datasheet J2004A-GFDN-DYNC
+	 * 			The configuration commands are queued and the end of the power on waiting time is signaled by a one-shot timer, then the function returns immediately.
 	 *
 	 * @return Nothing
 	 */
@@ -130,6 +130,44 @@ void timer::configureTimer4(uint16_t a_prescaler, uint16_t a_ctcValue)
 	}
 }
 
+void timer::configureTimer4FreeRunning(uint16_t a_prescaler)
+{
+	/* Configure the Timer/Counter4 Control Register A */
+	TCCR4A = 0 ;
+	/* Configure the Timer/Counter4 Control Register B : normal mode, the counter is never cleared */
+	TCCR4B = 0 ;
+
+	/* Enable compare A and overflow interrupts */
+	TIMSK4 = (1 << OCIE4A) | (1 << TOIE4);
+
+	/* Clear counter and pending flags */
+	TCNT4 = 0;
+	TIFR4 = (1 << OCF4A) | (1 << TOV4);
+
+	/* memorize prescaler value */
+	switch(a_prescaler)
+	{
+	case 1:
+		prescaler4 = (uint8_t)0b001;
+		break;
+	case 8:
+		prescaler4 = (uint8_t)0b010;
+		break;
+	case 64:
+		prescaler4 = (uint8_t)0b011;
+		break;
+	case 256:
+		prescaler4 = (uint8_t)0b100;
+		break;
+	case 1024:
+		prescaler4 = (uint8_t)0b101;
+		break;
+	default:
+		/* Keep default value */
+		break;
+	}
+}
+
 
 void timer::startTimer1()
 {
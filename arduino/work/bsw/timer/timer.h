@@ -53,6 +53,15 @@ public:
 	 */
 	void configureTimer4(uint16_t a_prescaler, uint16_t a_ctcValue);
 
+	/*!
+	 * @brief Configures Timer #4 in free-running mode
+	 * @details This function configures hardware timer #4 in normal mode : the counter is never cleared and overflows every 65536 counts.
+	 * 			The overflow interrupt and the compare A interrupt are enabled, the compare value shall be updated with setTimer4CompareValue.
+	 * @param [in] a_prescaler prescaler value
+	 * @return Nothing
+	 */
+	void configureTimer4FreeRunning(uint16_t a_prescaler);
+
 	/*!
 	 * @brief Start Timer #1
 	 * @details This functions starts Timer #1. Timer shall be initialized before this function is called.
@@ -117,6 +126,64 @@ public:
 		return TCNT4;
 	}
 
+	/*!
+	 * @brief Sets compare value of timer #4
+	 * @details This function writes the compare register OCR4A. In free-running mode, the compare interrupt is raised when the counter reaches this value.
+	 *
+	 * @param [in] a_cmpValue New compare value
+	 * @return Nothing
+	 */
+	inline void setTimer4CompareValue(uint16_t a_cmpValue)
+	{
+		OCR4A = a_cmpValue;
+	}
+
+	/*!
+	 * @brief Sets compare B value of timer #4
+	 * @details This function writes the compare register OCR4B. In free-running mode, the compare B interrupt is raised when the counter reaches this value, if it is enabled.
+	 *
+	 * @param [in] a_cmpValue New compare value
+	 * @return Nothing
+	 */
+	inline void setTimer4CompareBValue(uint16_t a_cmpValue)
+	{
+		OCR4B = a_cmpValue;
+	}
+
+	/*!
+	 * @brief Enables compare B interrupt of timer #4
+	 * @details This function clears the compare B flag, to discard a match which has occurred while the interrupt was disabled, and enables the compare B interrupt.
+	 *
+	 * @return Nothing
+	 */
+	inline void enableTimer4CompareBInterrupt()
+	{
+		TIFR4 = (1 << OCF4B);
+		TIMSK4 |= (1 << OCIE4B);
+	}
+
+	/*!
+	 * @brief Disables compare B interrupt of timer #4
+	 * @details This function disables the compare B interrupt.
+	 *
+	 * @return Nothing
+	 */
+	inline void disableTimer4CompareBInterrupt()
+	{
+		TIMSK4 &= ~(1 << OCIE4B);
+	}
+
+	/*!
+	 * @brief Timer #4 overflow flag get function
+	 * @details This function reads the overflow flag TOV4. It is set when the counter has wrapped and the overflow interrupt has not been served yet.
+	 *
+	 * @return True if an overflow is pending, false otherwise
+	 */
+	inline bool isTimer4OverflowPending()
+	{
+		return ((TIFR4 & (1 << TOV4)) != 0);
+	}
+
 private:
 	uint8_t prescaler1;
 	uint8_t prescaler3;
@@ -8,31 +8,58 @@
 
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/wdt.h>
 
 #include "../../lib/string/String.h"
 
+#include "../wdt/Watchdog.h"
 #include "usart.h"
 
 usart* p_global_BSW_usart;
 
-usart::usart(uint16_t a_BaudRate)
+/*!
+ * @brief Settings of the usually used baud rates
+ * @details The register values are computed at compile time, the double speed mode is selected if it gives a lower error.
+ * 			Only baud rates with an acceptable error at 16 MHz are listed, their error is not checked again.
+ */
+const T_usart_baud_config usart_baud_config_list[] =
+{
+		USART_BAUD_CONFIG(9600),
+		USART_BAUD_CONFIG(19200),
+		USART_BAUD_CONFIG(38400),
+		USART_BAUD_CONFIG(57600),
+		USART_BAUD_CONFIG(115200),
+		USART_BAUD_CONFIG(250000),
+		USART_BAUD_CONFIG(500000),
+		USART_BAUD_CONFIG(1000000)
+};
+
+usart::usart(uint32_t a_BaudRate)
 {
 	/* Set value of baud rate and then call hardware initialization function */
 	BaudRate = a_BaudRate;
+	isTxUsed = false;
+	rx_head = 0;
+	rx_tail = 0;
+
+	/* The transmission buffer is empty, the calling function waits for free space by default to avoid losing debug data */
+	tx_head = 0;
+	tx_tail = 0;
+	tx_count = 0;
+	tx_policy = USART_TX_POLICY_BLOCK;
+
 	usart_init();
 }
 
 void usart::usart_init()
 {
-	uint32_t ui32UBRR = F_CPU ;
-
-	ui32UBRR >>= 4 ; // (=) to ui32UBRR /= 16 but more efficient
-	ui32UBRR /= BaudRate ;
-	ui32UBRR -= 1 ;
+	T_usart_baud_config cnf;
 
-	/* Set baud rate */
-	UBRR0H = (uint8_t) ( (ui32UBRR>>8) & (0x000000FF) ) ;
-	UBRR0L = (uint8_t) ( ui32UBRR & (0x000000FF) ) ;
+	/* Set baud rate, the closest one is used even if its error is too high */
+	getBaudConfig(BaudRate, &cnf);
+	setBaudRegisters(&cnf);
 
 	/* Enable receiver and transmitter
 	 * Enable Rx complete interrupt    */
@@ -45,55 +72,272 @@ void usart::usart_init()
 
 
 
-void usart::usart_sendString(String *str)
+bool usart::usart_sendString(String *str)
 {
-	uint16_t i = 0;
-	uint8_t* data;
+	return sendChars(str->getString(), str->getSize());
+}
+
+bool usart::usart_sendString(uint8_t* str)
+{
+	uint16_t size = 0;
+
+	while(str[size] != '\0')
+		size++;
+
+	return sendChars(str, size);
+}
 
-	/* Check if input string is not empty */
-	if(str->getSize() != 0)
+bool usart::usart_sendString(const FlashString* str)
+{
+	const uint8_t* data = (const uint8_t*)str;
+	uint16_t size = 0;
+
+	while(pgm_read_byte(data + size) != '\0')
+		size++;
+
+	return sendChars(data, size, true);
+}
+
+bool usart::sendChars(const uint8_t* data, uint16_t size, bool isFlash)
+{
+	uint16_t i;
+	uint16_t tx_size;
+	uint8_t chr;
+
+	/* With drop policy, the string is sent only if it fits entirely in the buffer, including the added carriage returns */
+	if(tx_policy == USART_TX_POLICY_DROP)
 	{
-		data = str->getString();
-		/* Send each character of the string on usart bus */
-		for(i=0; i<str->getSize(); i++)
+		tx_size = size;
+		for(i=0; i<size; i++)
 		{
-			if(data[i]=='\n')
-				usart_transmit('\r');
-
-			usart_transmit(data[i]);
+			chr = isFlash ? pgm_read_byte(data + i) : data[i];
+			if(chr=='\n')
+				tx_size++;
 		}
+
+		if(tx_size > USART_TX_BUFFER_SIZE - tx_count)
+			return false;
 	}
+
+	/* Queue each character of the string, characters in flash memory are read one by one */
+	for(i=0; i<size; i++)
+	{
+		chr = isFlash ? pgm_read_byte(data + i) : data[i];
+
+		if((chr=='\n') && !usart_transmit('\r'))
+			return false;
+
+		if(!usart_transmit(chr))
+			return false;
+	}
+
+	return true;
+}
+
+bool usart::usart_sendByte(uint8_t data)
+{
+	return usart_transmit(data);
 }
 
-void usart::usart_sendByte(uint8_t data)
+bool usart::usart_sendBuffer(uint8_t* data, uint16_t size)
 {
-	usart_transmit(data);
+	uint16_t i;
+
+	/* With drop policy, the buffer is sent only if it fits entirely in the transmission buffer */
+	if((tx_policy == USART_TX_POLICY_DROP) && (size > USART_TX_BUFFER_SIZE - tx_count))
+		return false;
+
+	for(i=0; i<size; i++)
+	{
+		if(!usart_transmit(data[i]))
+			return false;
+	}
+
+	return true;
 }
 
 
-inline void usart::setBaudRate(uint16_t a_BaudRate)
+bool usart::setBaudRate(uint32_t a_BaudRate)
 {
+	T_usart_baud_config cnf;
+
+	if(!getBaudConfig(a_BaudRate, &cnf))
+		return false;
+
+	/* Wait until the transmission buffer is empty */
+	while(tx_count != 0)
+		waitTxSpace();
+
+	/* Wait until the last byte has been shifted out */
+	if(isTxUsed)
+		while(!(UCSR0A & (1<<TXC0)));
+
 	BaudRate = a_BaudRate;
+	setBaudRegisters(&cnf);
+
+	return true;
+}
+
+bool usart::getBaudConfig(uint32_t a_BaudRate, T_usart_baud_config* cnf)
+{
+	uint8_t i;
+	uint32_t deviation;
+
+	if(a_BaudRate == 0)
+		return false;
+
+	/* Look for the baud rate in the precomputed settings */
+	for(i=0; i<(sizeof(usart_baud_config_list)/sizeof(T_usart_baud_config)); i++)
+	{
+		if(usart_baud_config_list[i].baudrate == a_BaudRate)
+		{
+			*cnf = usart_baud_config_list[i];
+			return true;
+		}
+	}
+
+	/* Else compute the settings */
+	cnf->baudrate = a_BaudRate;
+	cnf->isDoubleSpeed = USART_IS_DOUBLE_SPEED_BETTER(a_BaudRate);
+
+	if(cnf->isDoubleSpeed)
+	{
+		cnf->ubrr = USART_UBRR(a_BaudRate, USART_DIV_DOUBLE_SPEED);
+		deviation = USART_BAUD_DEVIATION(a_BaudRate, USART_DIV_DOUBLE_SPEED);
+	}
+	else
+	{
+		cnf->ubrr = USART_UBRR(a_BaudRate, USART_DIV_NORMAL);
+		deviation = USART_BAUD_DEVIATION(a_BaudRate, USART_DIV_NORMAL);
+	}
+
+	/* The register value is saturated if the baud rate is out of range */
+	if(deviation == 0xFFFFFFFF)
+	{
+		if(a_BaudRate > F_CPU / USART_DIV_DOUBLE_SPEED)
+		{
+			cnf->ubrr = 0;
+			cnf->isDoubleSpeed = true;
+		}
+		else
+		{
+			cnf->ubrr = USART_UBRR_MAX;
+			cnf->isDoubleSpeed = false;
+		}
+
+		return false;
+	}
+
+	return (deviation <= (F_CPU / 1000) * USART_BAUD_MAX_ERROR_PERMIL);
+}
+
+void usart::setBaudRegisters(T_usart_baud_config* cnf)
+{
+	UBRR0H = (uint8_t)((cnf->ubrr >> 8) & 0x0F);
+	UBRR0L = (uint8_t)(cnf->ubrr & 0xFF);
+
+	/* The error flags shall be written to 0 */
+	if(cnf->isDoubleSpeed)
+		UCSR0A = (1<<U2X0);
+	else
+		UCSR0A = 0;
 }
 
 
 
-void usart::usart_transmit( uint8_t Data )
+bool usart::usart_transmit( uint8_t Data )
 {
-	/* Wait for empty transmit buffer */
-	while ( !( UCSR0A & (1<<UDRE0)) ) ;
+	uint8_t sreg;
+
+	/* Wait for a free place in the buffer if the policy allows it */
+	while(tx_count >= USART_TX_BUFFER_SIZE)
+	{
+		if(tx_policy != USART_TX_POLICY_BLOCK)
+			return false;
+
+		waitTxSpace();
+	}
+
+	/* Put data into buffer, it is sent by the data register empty interrupt */
+	sreg = SREG;
+	cli();
 
-	/* Put data into buffer, sends the data */
-	UDR0 = Data ;
+	tx_buffer[tx_head] = Data;
+	tx_head = (tx_head + 1) & (USART_TX_BUFFER_SIZE - 1);
+	tx_count++;
+
+	UCSR0B |= (1<<UDRIE0);
+
+	SREG = sreg;
+
+	return true;
+}
+
+void usart::waitTxSpace()
+{
+	/* The transmission of a full buffer can last longer than the watchdog timeout at low baud rates.
+	 * The caller is not stuck as long as the bytes are sent, then the watchdog is reset while waiting */
+	if(p_global_BSW_wdg != 0)
+		p_global_BSW_wdg->reset();
+
+	/* If interrupts are enabled, the buffer is emptied by the interrupt.
+	 * Else the data register is polled and the interrupt function is called directly */
+	if((SREG & (1 << SREG_I)) == 0)
+	{
+		while ( !( UCSR0A & (1<<UDRE0)) ) ;
+		usart_txInterrupt();
+	}
+}
+
+void usart::usart_txInterrupt()
+{
+	if(tx_count == 0)
+	{
+		/* Nothing more to send, disable the interrupt */
+		UCSR0B &= ~(1<<UDRIE0);
+		return;
+	}
+
+	/* Put data into the data register, sends the data.
+	 * The transmit complete flag is cleared, it is set again when the data is shifted out */
+	UDR0 = tx_buffer[tx_tail];
+	UCSR0A = (UCSR0A & (1<<U2X0)) | (1<<TXC0);
+	isTxUsed = true;
+	tx_tail = (tx_tail + 1) & (USART_TX_BUFFER_SIZE - 1);
+	tx_count--;
+
+	if(tx_count == 0)
+		UCSR0B &= ~(1<<UDRIE0);
+}
+
+bool usart::usart_read(uint8_t* data)
+{
+	uint8_t tail = rx_tail;
+
+	/* The buffer is empty */
+	if(tail == rx_head)
+		return false;
+
+	/* Read the byte before releasing its place */
+	*data = rx_buffer[tail];
+	rx_tail = (tail + 1) & (USART_RX_BUFFER_SIZE - 1);
+
+	return true;
 }
 
-uint8_t usart::usart_read()
+void usart::usart_rxInterrupt()
 {
-	/* Wait for data to be received */
-	while ( !(UCSR0A & (1<<RXC0)) );
+	/* Get received data from buffer, reading the register clears the interrupt flag */
+	uint8_t data = UDR0;
+	uint8_t head = rx_head;
+	uint8_t next_head = (head + 1) & (USART_RX_BUFFER_SIZE - 1);
 
-	/* Get and return received data from buffer */
-	return UDR0;
+	/* Write the byte before publishing it, it is lost if the buffer is full */
+	if(next_head != rx_tail)
+	{
+		rx_buffer[head] = data;
+		rx_head = next_head;
+	}
 }
 
 
@@ -9,6 +9,45 @@
 #ifndef WORK_BSW_USART_USART_H_
 #define WORK_BSW_USART_USART_H_
 
+#define USART_TX_BUFFER_SIZE 256 /*!< Size of the transmission ring buffer, shall be a power of 2 not greater than 256 */
+#define USART_RX_BUFFER_SIZE 16 /*!< Size of the reception ring buffer, shall be a power of 2 not greater than 256. One place is kept empty to distinguish a full buffer from an empty one */
+
+#define USART_UBRR_MAX 4095 /*!< Maximum value of the 12-bit baud rate register */
+#define USART_BAUD_MAX_ERROR_PERMIL 25 /*!< A baud rate is refused if the generated rate differs from the requested one by more than 2.5 % (115200 baud has an error of 2.1 % at 16 MHz) */
+#define USART_DIV_NORMAL 16 /*!< Clock divider of the normal speed mode */
+#define USART_DIV_DOUBLE_SPEED 8 /*!< Clock divider of the double speed mode (U2X) */
+
+#define USART_UBRR(baud, div) (((F_CPU) + ((uint32_t)(div) * (baud)) / 2) / ((uint32_t)(div) * (baud)) - 1) /*!< Closest baud rate register value for the requested baud rate with the given clock divider */
+#define USART_BAUD_PRODUCT(baud, div) ((uint32_t)(div) * (baud) * (USART_UBRR(baud, div) + 1)) /*!< Clock frequency which would give exactly the requested baud rate with the selected register value */
+#define USART_BAUD_DEVIATION(baud, div) ((USART_UBRR(baud, div) > USART_UBRR_MAX) ? 0xFFFFFFFF : \
+		((USART_BAUD_PRODUCT(baud, div) > (F_CPU)) ? (USART_BAUD_PRODUCT(baud, div) - (F_CPU)) : ((F_CPU) - USART_BAUD_PRODUCT(baud, div)))) /*!< Baud rate error, expressed as a deviation from F_CPU (Hz) */
+#define USART_IS_DOUBLE_SPEED_BETTER(baud) (USART_BAUD_DEVIATION(baud, USART_DIV_DOUBLE_SPEED) < USART_BAUD_DEVIATION(baud, USART_DIV_NORMAL)) /*!< The double speed mode is used only if it gives a lower error, the normal mode samples the bits more robustly */
+#define USART_BAUD_CONFIG(baud) {baud, USART_IS_DOUBLE_SPEED_BETTER(baud) ? USART_UBRR(baud, USART_DIV_DOUBLE_SPEED) : USART_UBRR(baud, USART_DIV_NORMAL), USART_IS_DOUBLE_SPEED_BETTER(baud)} /*!< Baud rate configuration with the lowest error, computed at compile time for a constant baud rate */
+
+/*!
+ * @brief Baud rate configuration structure
+ * @details This structure contains the register settings used to generate a baud rate.
+ */
+typedef struct
+{
+	uint32_t baudrate; /*!< Baud rate */
+	uint16_t ubrr; /*!< Value of the baud rate register */
+	bool isDoubleSpeed; /*!< Double speed mode (U2X) activation */
+}
+T_usart_baud_config;
+
+/*!
+ * @brief Transmission buffer policy
+ * @details This enumeration defines the behavior of the transmission functions when the transmission buffer is full.
+ */
+typedef enum
+{
+	USART_TX_POLICY_DROP, /*!< A string which does not fit entirely in the buffer is not sent */
+	USART_TX_POLICY_BLOCK, /*!< The function waits until there is enough space in the buffer */
+	USART_TX_POLICY_TRUNCATE /*!< The beginning of the string is sent, the characters which do not fit in the buffer are lost */
+}
+T_usart_tx_policy;
+
 /*!
  * @brief USART serial bus class
  * @details This class defines all useful functions for USART serial bus
@@ -20,46 +59,108 @@ public:
 	/*!
 	 * @brief Class usart constructor
 	 * @details Initializes the class and call hardware initialization function
-	 * @param [in] a_BaudRate Desired Baud Rate (16 bit) - up to 57600
+	 * @param [in] a_BaudRate Desired Baud Rate - up to 1 Mbaud
 	 * @return Nothing.
 	 */
-	usart(uint16_t a_BaudRate);
+	usart(uint32_t a_BaudRate);
 
 	/*! @brief Send a string on USART link
-	 *  @details This function writes the string object data to the serial link using usart_transmit function
+	 *  @details This function copies the string object data in the transmission buffer and returns, the bytes are sent by the data register empty interrupt.
+	 *  		 If the buffer is full, the behavior is defined by the transmission policy.
 	 *  @param [in] str Pointer to the string being sent
-	 *  @return Nothing.
+	 *  @return True if the whole string has been queued, false otherwise.
+	 */
+	bool usart_sendString(String *str);
+
+	/*! @brief Send a chain of characters on USART link
+	 *  @details This function copies the characters in the transmission buffer until the final '\0' and returns, the bytes are sent by the data register empty interrupt.
+	 *  		 If the buffer is full, the behavior is defined by the transmission policy.
+	 *  @param [in] str Pointer to the chain of characters being sent
+	 *  @return True if the whole chain has been queued, false otherwise.
+	 */
+	bool usart_sendString(uint8_t* str);
+
+	/*! @brief Send a chain of characters stored in flash memory on USART link
+	 *  @details This function reads the characters in flash memory and copies them in the transmission buffer until the final '\0', no copy in RAM is needed.
+	 *  		 If the buffer is full, the behavior is defined by the transmission policy.
+	 *  @param [in] str Pointer to the chain of characters being sent, in flash memory
+	 *  @return True if the whole chain has been queued, false otherwise.
 	 */
-	void usart_sendString(String *str);
+	bool usart_sendString(const FlashString* str);
 
 	/*! @brief Send a single byte on USART link
-	 *  @details This function writes the given byte to the serial link using usart_transmit function
+	 *  @details This function copies the given byte in the transmission buffer and returns, the byte is sent by the data register empty interrupt.
 	 *  @param [in] data Data byte being sent
+	 *  @return True if the byte has been queued, false otherwise.
+	 */
+	bool usart_sendByte(uint8_t data);
+
+	/*! @brief Send a binary buffer on USART link
+	 *  @details This function copies the bytes of the buffer in the transmission buffer and returns. Unlike strings, the bytes are sent without any conversion.
+	 *  		 With USART_TX_POLICY_DROP policy, the buffer is queued only if it fits entirely in the transmission buffer.
+	 *  @param [in] data Pointer to the bytes to send
+	 *  @param [in] size Number of bytes to send
+	 *  @return True if the whole buffer has been queued, false otherwise.
+	 */
+	bool usart_sendBuffer(uint8_t* data, uint16_t size);
+
+	/*! @brief Transmission policy setting function
+	 *  @details This function sets the behavior of the transmission functions when the transmission buffer is full.
+	 *  @param [in] policy Requested policy
 	 *  @return Nothing.
 	 */
-	void usart_sendByte(uint8_t data);
+	inline void setTxPolicy(T_usart_tx_policy policy)
+	{
+		tx_policy = policy;
+	}
+
+	/*! @brief USART data register empty interrupt function
+	 *  @details This function is called by the data register empty interrupt. It writes the next byte of the transmission buffer in the data register,
+	 *  		 the interrupt is disabled when the buffer is empty.
+	 *  @return Nothing
+	 */
+	void usart_txInterrupt();
 
 	/*!
 	 * @brief Setting baud rate
-	 * @details This function sets the attribute BaudRate of the class usart
-	 * @param [in] a_BaudRate Desired Baud Rate (16 bit) - up to 57600
-	 * @return Nothing
+	 * @details This function changes the baud rate of the USART link. The normal or double speed mode is selected to get the lowest error.
+	 * 			The bytes already queued are sent with the previous baud rate : the function waits for the end of their transmission before updating the registers.
+	 * @param [in] a_BaudRate Desired Baud Rate - up to 1 Mbaud
+	 * @return True if the baud rate has been updated, false if it can not be generated with an error lower than USART_BAUD_MAX_ERROR_PERMIL
 	 */
-	void setBaudRate(uint16_t a_BaudRate);
+	bool setBaudRate(uint32_t a_BaudRate);
+
+	/*!
+	 * @brief Baud rate get function
+	 * @details This function returns the current baud rate of the USART link
+	 * @return Baud rate
+	 */
+	inline uint32_t getBaudRate()
+	{
+		return BaudRate;
+	}
 
 	/*! @brief USART hardware initialization
 	 *  @details This function will initialize the USART using selected baudrate.
-	 *  		 User must pay attention to select one of the usually used Baud Rate (9600, 19200, 38400, 57600).
-	 *  		 Note that since an uint16 is used as argument, Baud rate cannot be more than 57600.
+	 *  		 The register settings of the usually used baud rates are computed at compile time, the other ones are computed by the function.
 	 *  @return Nothing.
 	 */
 	void usart_init();
 
 	/*! @brief USART read function
-	 *  @details This function will read reception register of USART
-	 *  @return The function returns the 8 bits read from reception buffer
+	 *  @details This function gets the oldest byte memorized by the Rx complete interrupt in the reception buffer.
+	 *  		 The buffer has a single producer (the interrupt) and a single consumer (this function), then no lock is needed : each index is written by only one side.
+	 *  @param [out] data Received byte
+	 *  @return True if a byte has been read, false if the reception buffer is empty
+	 */
+	bool usart_read(uint8_t* data);
+
+	/*! @brief USART Rx complete interrupt function
+	 *  @details This function is called by the Rx complete interrupt. It reads the reception register of USART and copies the received byte in the reception buffer.
+	 *  		 The byte is lost if the buffer is full.
+	 *  @return Nothing
 	 */
-	uint8_t usart_read();
+	void usart_rxInterrupt();
 
 
 
@@ -67,14 +168,59 @@ public:
 private:
 
 	/*! @brief USART Transmit data
-	 *  @details Nothing Special. It just wait for the transmit buffer is empty before writing it again.
+	 *  @details This function copies the byte in the transmission buffer and enables the data register empty interrupt.
+	 *  		 If the buffer is full, the function waits for a free place with USART_TX_POLICY_BLOCK policy and returns false with the other policies.
 	 *  @param [in] Data Desired data char to transmit
+	 *  @return True if the byte has been queued, false otherwise.
+	 */
+	bool usart_transmit( uint8_t Data ) ;
+
+	/*! @brief Transmission buffer waiting function
+	 *  @details This function waits for the transmission of a byte of the buffer. If interrupts are disabled, the data register is polled and filled by this function.
+	 *  		 The watchdog is reset, as waiting for a full buffer at low baud rate can last longer than its timeout.
+	 *  @return Nothing.
+	 */
+	void waitTxSpace();
+
+	/*! @brief Characters transmission function
+	 *  @details This function copies the characters in the transmission buffer. A carriage return is added before each line feed.
+	 *  		 With USART_TX_POLICY_DROP policy, the characters are queued only if they all fit in the transmission buffer.
+	 *  @param [in] data Pointer to the characters being sent
+	 *  @param [in] size Number of characters
+	 *  @param [in] isFlash True if the characters are stored in flash memory, false if they are in RAM
+	 *  @return True if all characters have been queued, false otherwise.
+	 */
+	bool sendChars(const uint8_t* data, uint16_t size, bool isFlash = false);
+
+	/*! @brief Baud rate configuration function
+	 *  @details This function gets the register settings giving the lowest error for the requested baud rate. The settings of the usually used baud rates are read in a table,
+	 *  		 the other ones are computed.
+	 *  @param [in] a_BaudRate Requested baud rate
+	 *  @param [out] cnf Pointer to the baud rate configuration
+	 *  @return True if the error of the generated baud rate is acceptable, false otherwise.
+	 */
+	static bool getBaudConfig(uint32_t a_BaudRate, T_usart_baud_config* cnf);
+
+	/*! @brief Baud rate registers setting function
+	 *  @details This function writes the baud rate register and the double speed mode bit.
+	 *  @param [in] cnf Pointer to the baud rate configuration
 	 *  @return Nothing.
 	 */
-	void usart_transmit( uint8_t Data ) ;
+	void setBaudRegisters(T_usart_baud_config* cnf);
+
+
+	uint32_t BaudRate; /*!< Defines the baud rate used by driver */
+	volatile bool isTxUsed; /*!< Set when a byte has been written in the data register, the transmit complete flag is meaningful only after the first byte */
 
+	uint8_t rx_buffer[USART_RX_BUFFER_SIZE]; /*!< Reception ring buffer */
+	volatile uint8_t rx_head; /*!< Index where the next received byte is written, only updated by the interrupt */
+	volatile uint8_t rx_tail; /*!< Index of the next byte to read, only updated by the read function */
 
-	uint16_t BaudRate; /*!< Defines the baud rate used by driver */
+	uint8_t tx_buffer[USART_TX_BUFFER_SIZE]; /*!< Transmission ring buffer */
+	uint8_t tx_head; /*!< Index where the next byte to send is written */
+	volatile uint8_t tx_tail; /*!< Index of the next byte written in the data register */
+	volatile uint16_t tx_count; /*!< Number of bytes in the transmission buffer */
+	T_usart_tx_policy tx_policy; /*!< Behavior when the transmission buffer is full */
 
 };
 
@@ -0,0 +1,145 @@
+/*!
+ * @file StaticPool.h
+ *
+ * @brief Static pool library header file
+ *
+ * @date 18 oct. 2026
+ * @author nicls67
+ */
+
+#ifndef WORK_LIB_STATICPOOL_H_
+#define WORK_LIB_STATICPOOL_H_
+
+#define STATIC_POOL_INVALID_IDX 0xFF /*!< Index returned when no element can be allocated */
+#define STATIC_POOL_USED_ELEMENT 0xFE /*!< Free list value marking an allocated element */
+
+/*!
+ * @brief Static pool class
+ * @details This class defines a pool of CAPACITY elements of type T, stored in a contiguous table whose size is known at compile time. No dynamic allocation is performed.\n
+ * 			An element is identified by its index in the table. Allocation and release of an element are done in constant time using a chain of free elements.\n
+ * 			CAPACITY shall be lower than STATIC_POOL_USED_ELEMENT.
+ */
+template <typename T, uint8_t CAPACITY>
+class StaticPool
+{
+public:
+
+	/*!
+	 * @brief Class constructor
+	 * @details This constructor initializes the pool : all the elements are free.
+	 *
+	 * @return Nothing
+	 */
+	StaticPool()
+	{
+		Clear();
+	}
+
+	/*!
+	 * @brief Pool clearing function
+	 * @details This function releases all the elements of the pool.
+	 *
+	 * @return Nothing
+	 */
+	void Clear()
+	{
+		for(uint8_t i = 0; i < CAPACITY; i++)
+			next_free[i] = i + 1;
+
+		next_free[CAPACITY - 1] = STATIC_POOL_INVALID_IDX;
+		first_free = 0;
+		count = 0;
+	}
+
+	/*!
+	 * @brief Element allocation function
+	 * @details This function takes the first free element out of the chain of free elements. The content of the element is not initialized.
+	 *
+	 * @return Index of the allocated element, STATIC_POOL_INVALID_IDX if the pool is full
+	 */
+	uint8_t Allocate()
+	{
+		uint8_t idx = first_free;
+
+		if(idx != STATIC_POOL_INVALID_IDX)
+		{
+			first_free = next_free[idx];
+			next_free[idx] = STATIC_POOL_USED_ELEMENT;
+			count++;
+		}
+
+		return idx;
+	}
+
+	/*!
+	 * @brief Element release function
+	 * @details This function puts the given element back at the beginning of the chain of free elements. Nothing is done if the element is not allocated.
+	 *
+	 * @param [in] idx Index of the element to release
+	 * @return Nothing
+	 */
+	void Release(uint8_t idx)
+	{
+		if(isAllocated(idx))
+		{
+			next_free[idx] = first_free;
+			first_free = idx;
+			count--;
+		}
+	}
+
+	/*!
+	 * @brief Allocation check function
+	 * @details This function checks if the given index corresponds to an allocated element.
+	 *
+	 * @param [in] idx Index of the element
+	 * @return True if the element is allocated, false otherwise
+	 */
+	inline bool isAllocated(uint8_t idx)
+	{
+		return ((idx < CAPACITY) && (next_free[idx] == STATIC_POOL_USED_ELEMENT));
+	}
+
+	/*!
+	 * @brief Element get function
+	 * @details This function returns the pointer to the element at the given index. The index is not checked.
+	 *
+	 * @param [in] idx Index of the element
+	 * @return Pointer to the element
+	 */
+	inline T* getElement(uint8_t idx)
+	{
+		return &elements[idx];
+	}
+
+	/*!
+	 * @brief Element count get function
+	 * @details This function returns the number of allocated elements.
+	 *
+	 * @return Number of allocated elements
+	 */
+	inline uint8_t getCount()
+	{
+		return count;
+	}
+
+	/*!
+	 * @brief Capacity get function
+	 * @details This function returns the maximum number of elements of the pool.
+	 *
+	 * @return Capacity of the pool
+	 */
+	inline uint8_t getCapacity()
+	{
+		return CAPACITY;
+	}
+
+private:
+
+	T elements[CAPACITY]; /*!< Table of elements */
+	uint8_t next_free[CAPACITY]; /*!< Chain of free elements : index of the next free element, or STATIC_POOL_USED_ELEMENT if the element is allocated */
+	uint8_t first_free; /*!< Index of the first free element, STATIC_POOL_INVALID_IDX if the pool is full */
+	uint8_t count; /*!< Number of allocated elements */
+};
+
+#endif /* WORK_LIB_STATICPOOL_H_ */
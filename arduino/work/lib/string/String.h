@@ -10,40 +10,29 @@
 #ifndef WORK_LIB_STRING_STRING_H_
 #define WORK_LIB_STRING_STRING_H_
 
+#define STRING_INTEGER_MAX_SIZE 16 /*!< Maximum number of characters of an integer converted into a chain of characters (16 bits in base 2) */
+
+#define FSTR(str) ((const FlashString*)PSTR(str)) /*!< Stores a string literal in flash memory, only usable inside a function */
+#define FLASH_STRING(table) ((const FlashString*)(table)) /*!< Converts a table of characters declared with PROGMEM into a flash string pointer */
+
+/*!
+ * @brief Flash string type
+ * @details This type is never defined, it is only used to distinguish the pointers to chains of characters stored in flash memory from the pointers to RAM.
+ * 			The characters are read with pgm_read_byte by the functions taking a flash string pointer as parameter.
+ */
+class FlashString;
+
 /*!
  * @brief String management class
  * @details This class defines string object. It implements some functions to manage chains of characters.
- * 			The string is limited to 255 characters. It must finish by the character '\0'.
+ * 			The characters are stored in a fixed-size buffer given by the inherited class, no memory is allocated.
+ * 			The characters which do not fit in the buffer are lost. The string always finishes by the character '\0'.\n
+ * 			This class can not be instantiated, the string objects are declared using the template StaticString.
  */
 class String {
 
 public:
 
-	/*!
-	 * @brief Class constructor
-	 * @details This function initializes the class. The string is initialized with the data given in parameter.
-	 *
-	 * @param [in] str Pointer to initialization string
-	 * @return Nothing
-	 */
-	String(const uint8_t* str);
-
-	/*!
-	 * @brief Class constructor
-	 * @details This function initializes the class with an empty string. The size is set to 0.
-	 *
-	 * @return Nothing
-	 */
-	String();
-
-	/*!
-	 * @brief Class destructor
-	 * @details This function frees the memory used to contain the string when the object is deleted
-	 *
-	 * @return Nothing
-	 */
-	~String();
-
 	/*!
 	 * @brief String pointer get function
 	 * @details This function returns the pointer to the beginning of the string.
@@ -66,15 +55,37 @@ public:
 		return size;
 	}
 
+	/*!
+	 * @brief Capacity get function
+	 * @details This function returns the maximum number of characters of the string.
+	 *
+	 * @return Capacity of the string
+	 */
+	inline uint8_t getCapacity()
+	{
+		return capacity;
+	}
+
 	/*!
 	 * @brief String adding function
 	 * @details This functions adds the given string at the end of the main string. The string size is updated accordingly.
+	 * 			The string is truncated if the capacity is reached.
 	 *
 	 * @param [in] str New string to add
 	 * @return Nothing
 	 */
 	void appendString(uint8_t* str);
 
+	/*!
+	 * @brief Flash string adding function
+	 * @details This functions adds the given string stored in flash memory at the end of the main string. The string size is updated accordingly.
+	 * 			The string is truncated if the capacity is reached.
+	 *
+	 * @param [in] str Pointer to the string to add, in flash memory
+	 * @return Nothing
+	 */
+	void appendString(const FlashString* str);
+
 	/*!
 	 * @brief Integer adding function
 	 * @details This functions adds the given integer at the end of the main string. The string size is updated accordingly.
@@ -99,7 +110,7 @@ public:
 
 	/*!
 	 * @brief Character adding function
-	 * @details This functions adds the given character at the end of the main string. The string size is updated by 1.
+	 * @details This functions adds the given character at the end of the main string. The string size is updated by 1, unless the capacity is reached.
 	 *
 	 * @param [in] data 1-byte character to add
 	 * @return Nothing
@@ -108,7 +119,7 @@ public:
 
 	/*!
 	 * @brief String clear function
-	 * @details This function clears the string. Size is set to 0 and the memory is freed.
+	 * @details This function clears the string. Size is set to 0.
 	 *
 	 * @return Nothing
 	 */
@@ -126,19 +137,67 @@ public:
 	}
 
 
+protected:
+
+	/*!
+	 * @brief Class constructor
+	 * @details This function initializes the class with an empty string stored in the given buffer.
+	 *
+	 * @param [in] buffer Pointer to the buffer containing the characters, its size shall be the capacity plus one byte for the '\0' character
+	 * @param [in] buffer_capacity Maximum number of characters of the string
+	 * @return Nothing
+	 */
+	String(uint8_t* buffer, uint8_t buffer_capacity);
+
+
 private:
 
 	uint8_t* string; /*!< Pointer to the start of the string */
 	uint8_t size; /*!< Size of the string (the '\0' at the end of the string is not taken into account */
+	uint8_t capacity; /*!< Maximum size of the string */
+
+	/*!
+	 * @brief Copy constructor
+	 * @details The copy is forbidden : the copied object would point to the buffer of the original one.
+	 *
+	 * @param [in] str Copied string
+	 * @return Nothing
+	 */
+	String(const String& str);
 
 	/*!
-	 * @brief String size computation function
-	 * @details This function computes the sizes of the given string. It counts the number of character between the start of the string given in parameter and the next \0 character.
+	 * @brief Assignment operator
+	 * @details The assignment is forbidden : the assigned object would point to the buffer of the original one.
 	 *
-	 * @param [in] str Pointer to the beginning of the string
-	 * @return Number of character of the string (the \0 is excluded)
+	 * @param [in] str Assigned string
+	 * @return Reference to the string
 	 */
-	uint8_t ComputeStringSize(uint8_t* str);
+	String& operator=(const String& str);
+};
+
+/*!
+ * @brief Fixed-capacity string class
+ * @details This class defines a string object containing its own buffer, it can be declared on the stack or in another object.
+ * 			It is used through the functions of class String.
+ *
+ * @tparam N Maximum number of characters of the string (up to 255)
+ */
+template<uint8_t N>
+class StaticString : public String {
+
+public:
+
+	/*!
+	 * @brief Class constructor
+	 * @details This function initializes the class with an empty string.
+	 *
+	 * @return Nothing
+	 */
+	StaticString() : String(buffer, N) {}
+
+private:
+
+	uint8_t buffer[N + 1]; /*!< Characters of the string, with the final '\0' */
 };
 
 #endif /* WORK_LIB_STRING_STRING_H_ */
@@ -10,8 +10,9 @@
 #include <avr/io.h>
 #include <util/delay.h>
 #include <avr/interrupt.h>
+#include <avr/sleep.h>
 
-#include "lib/LinkedList/LinkedList.h"
+#include "lib/StaticPool/StaticPool.h"
 
 #include "bsw/dio/dio.h"
 
@@ -41,7 +42,7 @@ const T_ASW_init_cnf ASW_init_cnf =
 /*!
  * @brief Background task of program
  * @details This function initializes all the software and then goes into an infinite loop.
- *          Periodic interrupt will wake up the software to perform application
+ *          The loop launches the tasks released by the interrupts and sleeps when no task is ready. The scheduler timer interrupt will wake up the software at the next task deadline.
  */
 int main( void )
 {
@@ -54,8 +55,9 @@ int main( void )
 	else
 		isDebugModeActivated = false;
 
-	/* Initialize scheduler */
+	/* Initialize scheduler, tasks with the same period are spread over the PITs */
 	p_global_scheduler = new scheduler();
+	p_global_scheduler->setAutoPhase(true);
 
 	/* Initialize ASW */
 	asw_init();
@@ -63,11 +65,29 @@ int main( void )
 	/* Enable interrupts */
 	sei();
 
-	/* Configure and start main timer for periodic interrupt at 500ms */
+	/* Start main timer, the compare interrupt will be raised at the first task deadline */
 	p_global_scheduler->startScheduling();
 
+	/* Idle mode keeps the timers running */
+	set_sleep_mode(SLEEP_MODE_IDLE);
 
 	/* Go into an infinite loop */
-	while(1){}
+	while(1)
+	{
+		/* Launch all ready tasks */
+		p_global_scheduler->dispatchReadyTasks();
+
+		/* Sleep until the next interrupt if no task has been released meanwhile.
+		 * Interrupts are enabled just before the sleep instruction, then a task released after the check will wake up the CPU immediately */
+		cli();
+		if(!p_global_scheduler->isTaskReady())
+		{
+			sleep_enable();
+			sei();
+			sleep_cpu();
+			sleep_disable();
+		}
+		sei();
+	}
 }
 
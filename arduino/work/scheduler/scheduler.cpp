@@ -9,8 +9,9 @@
 
 #include <stdlib.h>
 #include <avr/io.h>
+#include <avr/interrupt.h>
 
-#include "../lib/LinkedList/LinkedList.h"
+#include "../lib/StaticPool/StaticPool.h"
 #include "../lib/operators/operators.h"
 
 #include "../bsw/timer/timer.h"
@@ -28,9 +29,6 @@ scheduler* p_global_scheduler;
 
 scheduler::scheduler()
 {
-	/* Initialize task configuration structure */
-	TasksLL_ptr = new LinkedList();
-
 	/* Create Timer object of needed */
 	if(p_global_BSW_timer == 0)
 		p_global_BSW_timer = new timer();
@@ -41,114 +39,1170 @@ scheduler::scheduler()
 		p_global_BSW_cpuload = new CpuLoad();
 	}
 
-	/* Initialize counter to 1, then the tasks are not started at first PIT to avoid HW initialization issue */
-	pit_number = 1;
+	/* Initialize time base, the timer is started at 0 */
+	timer_ovf_count = 0;
+	pit_number = 0;
+	pit_ticks_acc = 0;
+	load_window_start = 0;
+	load_busy_ticks = 0;
+	isStarted = false;
+	isAutoPhaseEnabled = false;
+
+	/* No task exists now, the task table is initialized by its constructor */
+	heap_count = 0;
+	current_priority = TASK_PRIO_IDLE;
+	preempt_ticks_acc = 0;
+	miss_callback = 0;
+	overrun_count = 0;
+	for(uint8_t i = 0; i < (TASK_PRIO_NB - 1); i++)
+		ready_mask[i] = 0;
+	for(uint8_t i = 0; i < SCHEDULER_MAX_TASK_NB; i++)
+		task_generation[i] = 0;
 
-	/* No task exists now */
-	task_count = 0;
+	/* No one-shot timer exists now, the dispatch tasks are created at first use */
+	wheel_count = 0;
+	wheel_cur_slot = 0;
+	for(uint8_t i = 0; i < SCHEDULER_WHEEL_SLOT_NB; i++)
+		wheel[i] = STATIC_POOL_INVALID_IDX;
+	for(uint8_t i = 0; i < (TASK_PRIO_NB - 1); i++)
+	{
+		expired_head[i] = STATIC_POOL_INVALID_IDX;
+		expired_tail[i] = STATIC_POOL_INVALID_IDX;
+		oneshot_task_handle[i] = SCHEDULER_INVALID_HANDLE;
+	}
 
-	/* Configure timer for periodic interrupt */
-	p_global_BSW_timer->configureTimer4(PRESCALER_PERIODIC_TIMER, TIMER_CTC_VALUE);
+	/* Configure timer in free-running mode, the compare register is programmed with the next deadline */
+	p_global_BSW_timer->configureTimer4FreeRunning(PRESCALER_PERIODIC_TIMER);
 }
 
-void scheduler::launchPeriodicTasks()
+void scheduler::releasePeriodicTasks()
 {
-	uint8_t task_nb = 0; /* Used for debug */
 	Task_t* cur_task;
+	uint32_t period_ticks;
+	uint32_t late_releases;
+	uint32_t missed;
+	uint32_t now = getTimerTicks();
+
+	/* Post all the tasks whose release time is reached into the ready mask */
+	while((heap_count > 0) && !isAfter(task_heap[0]->next_release, now))
+	{
+		cur_task = task_heap[0];
+
+		/* The period may be doubled by the miss handling, the next release is computed with the period in use */
+		period_ticks = cur_task->period_ticks;
 
-	/* Reset watchdog */
+		/* Number of releases reached in addition to the current one, if the task has been released late by more than one period */
+		late_releases = (now - cur_task->next_release) / period_ticks;
+		missed = late_releases;
+
+		/* A suspended task is not posted, only its release time is updated */
+		if(cur_task->isSuspended)
+			missed = 0;
+		else if(!isTaskPending(cur_task))
+		{
+			setTaskReady(cur_task);
+			cur_task->pending_release = cur_task->next_release;
+		}
+		else
+			missed++;
+
+		/* Next release stays on the period grid */
+		cur_task->next_release += (late_releases + 1) * period_ticks;
+
+		/* The releases which can not be posted are memorized or dropped according to the task policy.
+		 * With the degrade policy, the task is moved in the heap on the grid of its new period */
+		if(missed != 0)
+		{
+			if((cur_task->miss_policy == MISS_POLICY_CATCH_UP) && ((cur_task->backlog + missed) <= SCHEDULER_MAX_BACKLOG))
+				cur_task->backlog += missed;
+			else
+				recordDeadlineMiss(cur_task, 0);
+		}
+
+		heapSiftDown(0);
+	}
+
+	/* Program timer for the next deadline */
+	programNextDeadline();
+
+	/* If a task is running, launch now the released tasks which can preempt it.
+	 * Otherwise the background loop will launch the released tasks */
+	if(current_priority != TASK_PRIO_IDLE)
+		dispatchTasks();
+}
+
+void scheduler::dispatchReadyTasks()
+{
+	uint8_t sreg = SREG;
+
+	/* Reset watchdog : the background loop runs between two tasks, at least at each timer overflow when no task is running.
+	 * A task waiting for a peripheral for a long time shall reset the watchdog itself (see usart::waitTxSpace) */
 	p_global_BSW_wdg->reset();
 
-	/* First reset element pointer */
-	TasksLL_ptr->ResetElementPtr();
+	cli();
+	dispatchTasks();
+	SREG = sreg;
+}
+
+void scheduler::dispatchTasks()
+{
+	TaskPriority_t base_priority = current_priority;
+	TaskPriority_t prio;
+	Task_t* cur_task;
+	TaskPtr_t task_fct;
+	void* task_context;
+	TaskHandle_t handle;
+	uint8_t id;
+	uint32_t start_time;
+	uint32_t preempt_start;
+	uint32_t exec_ticks;
+	uint32_t release_time;
+	uint32_t now;
 
-	/* Check if there is at least one task to launch */
-	if(TasksLL_ptr->IsLLEmpty() == false)
+	while((prio = getHighestReadyPriority()) > base_priority)
 	{
-		/* Parse all tasks */
-		do
+		/* Take the ready task with the lowest identifier out of the mask.
+		 * The function pointer is read with interrupts disabled as the task could be removed by an interrupt */
+		id = 0;
+		while((ready_mask[prio - 1] & ((TaskMask_t)1 << id)) == 0)
+			id++;
+
+		ready_mask[prio - 1] &= ~((TaskMask_t)1 << id);
+		cur_task = task_table.getElement(id);
+		task_fct = cur_task->TaskPtr;
+		task_context = cur_task->context;
+		handle = makeHandle(id);
+		release_time = cur_task->pending_release;
+
+		/* With the catch up policy, the next delayed release is posted immediately */
+		if(cur_task->backlog != 0)
 		{
-			cur_task = (Task_t*)(TasksLL_ptr->getCurrentElement());
-			/* If the task shall be launched at the current cycle */
-			if((pit_number % (cur_task->period / SW_PERIOD_MS)) == 0)
-			{
-				task_nb++;
+			cur_task->backlog--;
+			cur_task->pending_release += cur_task->period_ticks;
+			setTaskReady(cur_task);
+		}
 
-				/* Launch the task */
-				(*cur_task->TaskPtr)();
-			}
+		/* Raise system priority to the task threshold */
+		current_priority = cur_task->threshold;
+
+		/* Launch the task */
+		preempt_start = preempt_ticks_acc;
+		start_time = getTimerTicks();
+
+		sei();
+		(*task_fct)(task_context);
+		cli();
+
+		now = getTimerTicks();
+		current_priority = base_priority;
 
+		/* Net execution time : the time spent in nested tasks is subtracted */
+		exec_ticks = (now - start_time) - (preempt_ticks_acc - preempt_start);
+		preempt_ticks_acc += exec_ticks;
+
+		/* The task may have removed itself, and its table entry may have been reused */
+		cur_task = getTask(handle);
+		if(cur_task != 0)
+		{
+			updateTaskProfile(id, exec_ticks);
+
+			/* The deadline of a periodic task is its next release */
+			if((cur_task->period != 0) && isAfter(now, release_time + cur_task->period_ticks))
+				recordDeadlineMiss(cur_task, now - (release_time + cur_task->period_ticks));
+		}
+
+		/* Compute CPU load, the measurement window is also updated by the overflow interrupt.
+		 * CPU load is only measured at background level, the duration of nested tasks is included in the duration of the preempted task */
+		if(base_priority == TASK_PRIO_IDLE)
+		{
+			load_busy_ticks += now - start_time;
+			updateLoadWindow(now);
 		}
-		while(TasksLL_ptr->MoveToNextElement());
 	}
+}
 
-	/* Compute CPU load */
-	if(p_global_BSW_cpuload != 0)
-		p_global_BSW_cpuload->ComputeCPULoad();
+TaskPriority_t scheduler::getHighestReadyPriority()
+{
+	uint8_t prio;
+
+	for(prio = TASK_PRIO_NB - 1; prio > TASK_PRIO_IDLE; prio--)
+	{
+		if(ready_mask[prio - 1] != 0)
+			break;
+	}
 
-	/* Increment counter */
-	pit_number++;
+	return (TaskPriority_t)prio;
+}
+
+void scheduler::oneShotInterrupt()
+{
+	uint32_t now = getTimerTicks();
+	uint32_t now_slot = now / SCHEDULER_WHEEL_SLOT_TICKS;
+	uint8_t nb_slots;
+
+	/* Process all the slots elapsed since the last interrupt, including the current one.
+	 * A slot contains the timers of all rotations, then each slot is processed at most once */
+	if((now_slot - wheel_cur_slot) >= SCHEDULER_WHEEL_SLOT_NB)
+		nb_slots = SCHEDULER_WHEEL_SLOT_NB;
+	else
+		nb_slots = (uint8_t)(now_slot - wheel_cur_slot) + 1;
+
+	for(uint8_t i = 0; i < nb_slots; i++)
+		expireWheelSlot((uint8_t)((wheel_cur_slot + i) & (SCHEDULER_WHEEL_SLOT_NB - 1)), now);
+
+	/* The current slot may still contain timers expiring later, it will be processed again */
+	wheel_cur_slot = now_slot;
+
+	programNextExpiry();
+}
+
+void scheduler::timerOverflowInterrupt()
+{
+	/* Extend time base */
+	timer_ovf_count++;
+
+	/* Update PIT counter, a software period is longer than a timer overflow period then the counter is incremented at most once */
+	pit_ticks_acc += SCHEDULER_TIMER_OVF_TICKS;
+	if(pit_ticks_acc >= SCHEDULER_PIT_TICKS)
+	{
+		pit_ticks_acc -= SCHEDULER_PIT_TICKS;
+		pit_number++;
+	}
+
+	/* Close CPU load window if no task has been launched during the whole window */
+	updateLoadWindow(getTimerTicks());
 }
 
 void scheduler::startScheduling()
 {
+	isStarted = true;
+
+	/* Program first deadline and start timer */
+	programNextDeadline();
 	p_global_BSW_timer->startTimer4();
 }
 
 
-void scheduler::addPeriodicTask(TaskPtr_t task_ptr, uint16_t a_period)
+TaskHandle_t scheduler::addPeriodicTask(TaskPtr_t task_ptr, uint16_t a_period, TaskPriority_t a_priority, void* a_context, TaskPriority_t a_threshold)
 {
 	Task_t* new_task;
+	uint32_t load[SCHEDULER_LOAD_SLOT_NB];
+	uint8_t sreg;
 
-	/* Create a new task with the given parameters */
-	new_task = new Task_t;
-	new_task->TaskPtr = task_ptr;
-	new_task->period = a_period;
+	/* The period shall not be 0, as it is used to identify event tasks */
+	if(a_period == 0)
+		return SCHEDULER_INVALID_HANDLE;
+
+	/* The heap is also used in interrupt context, disable interrupts during the update */
+	sreg = SREG;
+	cli();
+
+	new_task = createTask(task_ptr, a_period, a_priority, a_context, a_threshold);
+
+	if(new_task == 0)
+	{
+		SREG = sreg;
+		return SCHEDULER_INVALID_HANDLE;
+	}
+
+	/* In automatic mode, the task is released in the least loaded PITs */
+	if(isAutoPhaseEnabled && ((a_period % SW_PERIOD_MS) == 0))
+	{
+		computeTickLoad(load);
+		new_task->phase = findBestPhase(load, new_task);
+	}
+
+	/* First release is the next multiple of the period since scheduler start, shifted by the phase */
+	new_task->next_release = getNextGridRelease(new_task);
+
+	/* Insert the task in the heap */
+	new_task->heap_idx = heap_count;
+	task_heap[heap_count] = new_task;
+	heap_count++;
+	heapSiftUp(new_task->heap_idx);
+
+	/* If the new task is the next one to be released, update timer compare value */
+	if(isStarted && (task_heap[0] == new_task))
+		programNextDeadline();
+
+	SREG = sreg;
+
+	return makeHandle(new_task->id);
+}
+
+TaskHandle_t scheduler::addEventTask(TaskPtr_t task_ptr, TaskPriority_t a_priority, void* a_context, TaskPriority_t a_threshold)
+{
+	Task_t* new_task;
+	uint8_t sreg = SREG;
+
+	cli();
+	new_task = createTask(task_ptr, 0, a_priority, a_context, a_threshold);
+	SREG = sreg;
+
+	if(new_task == 0)
+		return SCHEDULER_INVALID_HANDLE;
+	else
+		return makeHandle(new_task->id);
+}
+
+bool scheduler::scheduleOnce(OneShotPtr_t fct_ptr, uint16_t delay_ms, void* arg, TaskPriority_t a_priority)
+{
+	OneShot_t* timer_ptr;
+	uint8_t idx;
+	uint8_t slot;
+	uint32_t now;
+	uint8_t sreg;
+
+	/* Background priority level is reserved */
+	if((a_priority == TASK_PRIO_IDLE) || (a_priority >= TASK_PRIO_NB))
+		return false;
+
+	sreg = SREG;
+	cli();
+
+	/* Create the dispatch task of this priority level at first use */
+	if(oneshot_task_handle[a_priority - 1] == SCHEDULER_INVALID_HANDLE)
+		oneshot_task_handle[a_priority - 1] = addEventTask(&scheduler::oneShotDispatch_task, a_priority, this);
+
+	idx = oneshot_table.Allocate();
+
+	if((oneshot_task_handle[a_priority - 1] == SCHEDULER_INVALID_HANDLE) || (idx == STATIC_POOL_INVALID_IDX))
+	{
+		oneshot_table.Release(idx);
+		SREG = sreg;
+		return false;
+	}
+
+	now = getTimerTicks();
+
+	timer_ptr = oneshot_table.getElement(idx);
+	timer_ptr->fct_ptr = fct_ptr;
+	timer_ptr->arg = arg;
+	timer_ptr->priority = a_priority;
+	timer_ptr->expiry = now + ((uint32_t)delay_ms * SCHEDULER_TICKS_PER_MS);
+
+	/* If the wheel is empty, its position has not been updated since the last expiry */
+	if(wheel_count == 0)
+		wheel_cur_slot = now / SCHEDULER_WHEEL_SLOT_TICKS;
+
+	/* Insert the timer in the slot of its expiry time */
+	slot = (uint8_t)((timer_ptr->expiry / SCHEDULER_WHEEL_SLOT_TICKS) & (SCHEDULER_WHEEL_SLOT_NB - 1));
+	timer_ptr->next = wheel[slot];
+	wheel[slot] = idx;
+	wheel_count++;
+
+	programNextExpiry();
+
+	SREG = sreg;
+
+	return true;
+}
+
+void scheduler::oneShotDispatch_task(void* context)
+{
+	scheduler* sched_ptr = (scheduler*)context;
+
+	/* The threshold of the dispatch tasks is equal to their priority, then the system priority is the priority of the running dispatch task */
+	sched_ptr->runExpiredOneShots(sched_ptr->current_priority);
+}
 
-	TasksLL_ptr->AttachNewElement((void*)new_task);
+void scheduler::runExpiredOneShots(TaskPriority_t prio)
+{
+	OneShot_t* timer_ptr;
+	OneShotPtr_t fct_ptr;
+	void* arg;
+	uint8_t idx;
+	uint8_t sreg;
+
+	while(1)
+	{
+		sreg = SREG;
+		cli();
+
+		idx = expired_head[prio - 1];
+
+		if(idx == STATIC_POOL_INVALID_IDX)
+		{
+			SREG = sreg;
+			break;
+		}
+
+		/* Take the first timer out of the expired list and release it, then the function can schedule a new timer */
+		timer_ptr = oneshot_table.getElement(idx);
+		expired_head[prio - 1] = timer_ptr->next;
+		if(timer_ptr->next == STATIC_POOL_INVALID_IDX)
+			expired_tail[prio - 1] = STATIC_POOL_INVALID_IDX;
+
+		fct_ptr = timer_ptr->fct_ptr;
+		arg = timer_ptr->arg;
+		oneshot_table.Release(idx);
+
+		SREG = sreg;
+
+		(*fct_ptr)(arg);
+	}
+}
+
+void scheduler::expireWheelSlot(uint8_t slot, uint32_t now)
+{
+	OneShot_t* timer_ptr;
+	uint8_t idx = wheel[slot];
+	uint8_t prev = STATIC_POOL_INVALID_IDX;
+	uint8_t next;
+
+	while(idx != STATIC_POOL_INVALID_IDX)
+	{
+		timer_ptr = oneshot_table.getElement(idx);
+		next = timer_ptr->next;
+
+		if(!isAfter(timer_ptr->expiry, now))
+		{
+			/* Remove the timer from the slot */
+			if(prev == STATIC_POOL_INVALID_IDX)
+				wheel[slot] = next;
+			else
+				oneshot_table.getElement(prev)->next = next;
+
+			wheel_count--;
+
+			/* Append the timer to the expired list of its priority and activate the dispatch task */
+			timer_ptr->next = STATIC_POOL_INVALID_IDX;
+
+			if(expired_tail[timer_ptr->priority - 1] == STATIC_POOL_INVALID_IDX)
+				expired_head[timer_ptr->priority - 1] = idx;
+			else
+				oneshot_table.getElement(expired_tail[timer_ptr->priority - 1])->next = idx;
+
+			expired_tail[timer_ptr->priority - 1] = idx;
+
+			activateTask(oneshot_task_handle[timer_ptr->priority - 1]);
+		}
+		else
+			prev = idx;
+
+		idx = next;
+	}
+}
+
+void scheduler::programNextExpiry()
+{
+	OneShot_t* timer_ptr;
+	uint32_t deadline;
+	uint32_t min_deadline;
+	uint32_t slot_number;
+	uint8_t idx;
+	bool isFound = false;
+
+	if(wheel_count == 0)
+	{
+		p_global_BSW_timer->disableTimer4CompareBInterrupt();
+		return;
+	}
+
+	/* By default, wake up at the end of the current rotation to process the timers of the next rotations */
+	deadline = (wheel_cur_slot + SCHEDULER_WHEEL_SLOT_NB) * SCHEDULER_WHEEL_SLOT_TICKS;
+
+	/* Find the first slot containing a timer of the current rotation */
+	for(uint8_t i = 0; (i < SCHEDULER_WHEEL_SLOT_NB) && !isFound; i++)
+	{
+		slot_number = wheel_cur_slot + i;
+		idx = wheel[slot_number & (SCHEDULER_WHEEL_SLOT_NB - 1)];
+
+		while(idx != STATIC_POOL_INVALID_IDX)
+		{
+			timer_ptr = oneshot_table.getElement(idx);
+
+			if(((timer_ptr->expiry / SCHEDULER_WHEEL_SLOT_TICKS) == slot_number) && (!isFound || isAfter(deadline, timer_ptr->expiry)))
+			{
+				deadline = timer_ptr->expiry;
+				isFound = true;
+			}
 
-	task_count++;
+			idx = timer_ptr->next;
+		}
+	}
+
+	/* Same protection as for the compare A register : the deadline shall not be too close */
+	min_deadline = getTimerTicks() + SCHEDULER_MIN_DEADLINE_TICKS;
+
+	if(isAfter(min_deadline, deadline))
+		deadline = min_deadline;
+
+	p_global_BSW_timer->setTimer4CompareBValue((uint16_t)deadline);
+	p_global_BSW_timer->enableTimer4CompareBInterrupt();
+}
+
+bool scheduler::activateTask(TaskHandle_t handle)
+{
+	Task_t* task_data_ptr;
+	bool result = false;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	task_data_ptr = getTask(handle);
+
+	if((task_data_ptr != 0) && !task_data_ptr->isSuspended)
+	{
+		setTaskReady(task_data_ptr);
+		result = true;
+	}
+
+	SREG = sreg;
+
+	return result;
 }
 
 uint32_t scheduler::getPitNumber()
 {
-	return pit_number;
+	uint32_t pit;
+	uint32_t pit_ticks;
+
+	getPitTime(&pit, &pit_ticks);
+
+	return pit;
+}
+
+uint32_t scheduler::getPitTime(uint32_t* pit, uint32_t* pit_ticks)
+{
+	uint16_t high;
+	uint16_t low;
+	uint32_t ticks;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	high = timer_ovf_count;
+	*pit = pit_number;
+	low = p_global_BSW_timer->getTimer4Value();
+	ticks = pit_ticks_acc + low;
+
+	/* Take into account an overflow which has not been served yet */
+	if(p_global_BSW_timer->isTimer4OverflowPending() && (low < 0x8000))
+	{
+		high++;
+		ticks += SCHEDULER_TIMER_OVF_TICKS;
+	}
+
+	SREG = sreg;
+
+	/* The accumulated ticks are less than 2 software periods */
+	if(ticks >= SCHEDULER_PIT_TICKS)
+	{
+		ticks -= SCHEDULER_PIT_TICKS;
+		(*pit)++;
+	}
+	if(ticks >= SCHEDULER_PIT_TICKS)
+	{
+		ticks -= SCHEDULER_PIT_TICKS;
+		(*pit)++;
+	}
+
+	*pit_ticks = ticks;
+
+	return (((uint32_t)high << 16) | low);
+}
+
+uint32_t scheduler::getTimerTicks()
+{
+	uint16_t high;
+	uint16_t low;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	high = timer_ovf_count;
+	low = p_global_BSW_timer->getTimer4Value();
+
+	/* If an overflow has occurred but has not been served yet, the counter value has wrapped */
+	if(p_global_BSW_timer->isTimer4OverflowPending() && (low < 0x8000))
+		high++;
+
+	SREG = sreg;
+
+	return (((uint32_t)high << 16) | low);
+}
+
+
+bool scheduler::removeTask(TaskHandle_t handle)
+{
+	Task_t* task_data_ptr;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	task_data_ptr = getTask(handle);
+
+	if(task_data_ptr != 0)
+	{
+		/* Event tasks are not in the deadline heap */
+		if(task_data_ptr->period != 0)
+			heapRemove(task_data_ptr);
+
+		/* Cancel the pending release, invalidate the handle and free the table entry */
+		ready_mask[task_data_ptr->priority - 1] &= ~((TaskMask_t)1 << task_data_ptr->id);
+		task_generation[task_data_ptr->id]++;
+		task_table.Release(task_data_ptr->id);
+	}
+
+	SREG = sreg;
+
+	return (task_data_ptr != 0);
+}
+
+bool scheduler::suspendTask(TaskHandle_t handle)
+{
+	Task_t* task_data_ptr;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	task_data_ptr = getTask(handle);
+
+	if(task_data_ptr != 0)
+	{
+		/* Cancel the pending release and the delayed releases */
+		task_data_ptr->isSuspended = true;
+		task_data_ptr->backlog = 0;
+		ready_mask[task_data_ptr->priority - 1] &= ~((TaskMask_t)1 << task_data_ptr->id);
+	}
+
+	SREG = sreg;
+
+	return (task_data_ptr != 0);
+}
+
+bool scheduler::resumeTask(TaskHandle_t handle)
+{
+	Task_t* task_data_ptr;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	task_data_ptr = getTask(handle);
+
+	if(task_data_ptr != 0)
+		task_data_ptr->isSuspended = false;
+
+	SREG = sreg;
+
+	return (task_data_ptr != 0);
 }
 
+bool scheduler::updateTaskPeriod(TaskHandle_t handle, uint16_t period)
+{
+	Task_t* task_data_ptr;
+	bool result = false;
+	uint8_t sreg = SREG;
+
+	if(period == 0)
+		return false;
 
-bool scheduler::removePeriodicTask(TaskPtr_t task_ptr)
+	cli();
+
+	task_data_ptr = getTask(handle);
+
+	/* An event task can not become periodic */
+	if((task_data_ptr != 0) && (task_data_ptr->period != 0))
+	{
+		task_data_ptr->period = period;
+		task_data_ptr->period_ticks = (uint32_t)period * SCHEDULER_TICKS_PER_MS;
+		alignTaskPeriod(task_data_ptr);
+		result = true;
+	}
+
+	SREG = sreg;
+
+	return result;
+}
+
+bool scheduler::setTaskPhase(TaskHandle_t handle, uint16_t phase)
 {
-	bool result;
+	Task_t* task_data_ptr;
+	bool result = false;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	task_data_ptr = getTask(handle);
 
-	result = TasksLL_ptr->RemoveElement((CompareFctPtr_t)&scheduler::LLElementCompare, (void*)task_ptr);
+	if((task_data_ptr != 0) && (task_data_ptr->period != 0) && (phase < task_data_ptr->period))
+	{
+		applyTaskPhase(task_data_ptr, phase);
+		result = true;
+	}
 
-	if(result)
-		task_count--;
+	SREG = sreg;
 
 	return result;
 }
 
-bool scheduler::LLElementCompare(void* LLElement, void* CompareElement)
+void scheduler::balanceTaskPhases()
+{
+	uint32_t load[SCHEDULER_LOAD_SLOT_NB];
+	TaskMask_t placed_mask = 0;
+	Task_t* task;
+	Task_t* best_task;
+	uint8_t sreg = SREG;
+
+	cli();
+
+	for(uint8_t i = 0; i < SCHEDULER_LOAD_SLOT_NB; i++)
+		load[i] = 0;
+
+	/* The tasks out of the PIT grid can not be moved, their load is counted first */
+	for(uint8_t i = 0; i < heap_count; i++)
+	{
+		task = task_heap[i];
+
+		if((task->period % SW_PERIOD_MS) != 0)
+		{
+			addTaskLoad(load, task, task->phase);
+			placed_mask |= ((TaskMask_t)1 << task->id);
+		}
+	}
+
+	/* Place the remaining tasks from the most to the least expensive one */
+	do
+	{
+		best_task = 0;
+
+		for(uint8_t i = 0; i < heap_count; i++)
+		{
+			task = task_heap[i];
+
+			if(((placed_mask & ((TaskMask_t)1 << task->id)) == 0) && ((best_task == 0) || (getTaskCost(task) > getTaskCost(best_task))))
+				best_task = task;
+		}
+
+		if(best_task != 0)
+		{
+			applyTaskPhase(best_task, findBestPhase(load, best_task));
+			addTaskLoad(load, best_task, best_task->phase);
+			placed_mask |= ((TaskMask_t)1 << best_task->id);
+		}
+	}
+	while(best_task != 0);
+
+	SREG = sreg;
+}
+
+uint32_t scheduler::getWorstTickLoad()
+{
+	uint32_t load[SCHEDULER_LOAD_SLOT_NB];
+	uint32_t worst_load = 0;
+	uint8_t sreg = SREG;
+
+	cli();
+	computeTickLoad(load);
+	SREG = sreg;
+
+	for(uint8_t i = 0; i < SCHEDULER_LOAD_SLOT_NB; i++)
+	{
+		if(load[i] > worst_load)
+			worst_load = load[i];
+	}
+
+	return worst_load;
+}
+
+scheduler::Task_t* scheduler::getTask(TaskHandle_t handle)
+{
+	uint8_t id = (uint8_t)(handle & 0xFF);
+
+	if(task_table.isAllocated(id) && ((uint8_t)(handle >> 8) == task_generation[id]))
+		return task_table.getElement(id);
+	else
+		return 0;
+}
+
+scheduler::Task_t* scheduler::createTask(TaskPtr_t task_ptr, uint16_t a_period, TaskPriority_t a_priority, void* a_context, TaskPriority_t a_threshold)
+{
+	Task_t* new_task;
+	uint8_t id;
+
+	/* Background priority level is reserved */
+	if((a_priority == TASK_PRIO_IDLE) || (a_priority >= TASK_PRIO_NB) || (a_threshold >= TASK_PRIO_NB))
+		return 0;
+
+	/* Allocate the task in the table, its index is used as identifier */
+	id = task_table.Allocate();
+
+	if(id == STATIC_POOL_INVALID_IDX)
+		return 0;
+
+	/* Initialize the task with the given parameters */
+	new_task = task_table.getElement(id);
+	new_task->TaskPtr = task_ptr;
+	new_task->context = a_context;
+	new_task->id = id;
+	new_task->isSuspended = false;
+	new_task->priority = a_priority;
+	new_task->threshold = (a_threshold > a_priority) ? a_threshold : a_priority;
+	new_task->period = a_period;
+	new_task->phase = 0;
+	new_task->period_ticks = (uint32_t)a_period * SCHEDULER_TICKS_PER_MS;
+	new_task->next_release = 0;
+	new_task->heap_idx = 0;
+	new_task->pending_release = 0;
+	new_task->backlog = 0;
+	new_task->miss_policy = MISS_POLICY_SKIP;
+
+	/* Initialize task profile */
+	task_profile[id].TaskPtr = task_ptr;
+	task_profile[id].wcet_ticks = 0;
+	task_profile[id].count = 0;
+	task_profile[id].min_ticks = 0xFFFFFFFF;
+	task_profile[id].max_ticks = 0;
+	task_profile[id].total_ticks = 0;
+	task_profile[id].miss_count = 0;
+	task_profile[id].worst_lateness_ticks = 0;
+	task_profile[id].last_miss_pit = 0;
+
+	return new_task;
+}
+
+void scheduler::heapSiftUp(uint8_t idx)
+{
+	Task_t* task = task_heap[idx];
+	uint8_t parent;
+
+	while(idx > 0)
+	{
+		parent = (idx - 1) / 2;
+
+		/* Stop when the parent is released before the task */
+		if(!isAfter(task_heap[parent]->next_release, task->next_release))
+			break;
+
+		task_heap[idx] = task_heap[parent];
+		task_heap[idx]->heap_idx = idx;
+		idx = parent;
+	}
+
+	task_heap[idx] = task;
+	task->heap_idx = idx;
+}
+
+void scheduler::heapSiftDown(uint8_t idx)
+{
+	Task_t* task = task_heap[idx];
+	uint8_t child;
+
+	while((child = (2 * idx) + 1) < heap_count)
+	{
+		/* Select the child with the earliest release time */
+		if(((child + 1) < heap_count) && isAfter(task_heap[child]->next_release, task_heap[child + 1]->next_release))
+			child++;
+
+		/* Stop when the task is released before its children */
+		if(!isAfter(task->next_release, task_heap[child]->next_release))
+			break;
+
+		task_heap[idx] = task_heap[child];
+		task_heap[idx]->heap_idx = idx;
+		idx = child;
+	}
+
+	task_heap[idx] = task;
+	task->heap_idx = idx;
+}
+
+void scheduler::heapRemove(Task_t* task)
+{
+	uint8_t idx = task->heap_idx;
+
+	heap_count--;
+
+	/* Move the last task at the position of the removed one and restore heap order */
+	if(idx != heap_count)
+	{
+		task_heap[idx] = task_heap[heap_count];
+		task_heap[idx]->heap_idx = idx;
+		heapSiftUp(idx);
+		heapSiftDown(task_heap[idx]->heap_idx);
+	}
+}
+
+uint32_t scheduler::getNextGridRelease(Task_t* task)
+{
+	uint32_t pit;
+	uint32_t pit_ticks;
+	uint32_t grid_pos;
+	uint32_t now = getPitTime(&pit, &pit_ticks);
+
+	/* The grid is anchored on the scheduler start and located with the PIT number : the 32-bit time base wraps around every 2^32 ticks,
+	 * which is not a multiple of the task periods. Position of the start of the current PIT in the period (ms), then of the current time (ticks) */
+	grid_pos = (((pit % task->period) * SW_PERIOD_MS) % task->period) * SCHEDULER_TICKS_PER_MS + pit_ticks;
+
+	/* Position relative to the phase, the next release is at the end of the current period of the grid */
+	grid_pos = (grid_pos + task->period_ticks - ((uint32_t)task->phase * SCHEDULER_TICKS_PER_MS)) % task->period_ticks;
+
+	return now + (task->period_ticks - grid_pos);
+}
+
+void scheduler::alignTaskPeriod(Task_t* task)
 {
-	Task_t* task_ptr = (Task_t*)LLElement;
-	TaskPtr_t compare_ptr = (TaskPtr_t)CompareElement;
+	uint32_t load[SCHEDULER_LOAD_SLOT_NB];
+	uint16_t phase;
 
-	if(task_ptr->TaskPtr == compare_ptr)
-		return true;
+	/* In automatic mode, the task is placed again in the least loaded PITs, its own load is not counted */
+	if(isAutoPhaseEnabled && ((task->period % SW_PERIOD_MS) == 0))
+	{
+		computeTickLoad(load, task);
+		phase = findBestPhase(load, task);
+	}
+	else
+		phase = task->phase % task->period;
+
+	/* The next release is moved on the grid assumed by the load table */
+	applyTaskPhase(task, phase);
+}
+
+void scheduler::applyTaskPhase(Task_t* task, uint16_t phase)
+{
+	task->phase = phase;
+	task->next_release = getNextGridRelease(task);
+
+	/* Move the task to its new place in the heap */
+	heapSiftUp(task->heap_idx);
+	heapSiftDown(task->heap_idx);
+
+	if(isStarted)
+		programNextDeadline();
+}
+
+uint32_t scheduler::getTaskCost(Task_t* task)
+{
+	if(task_profile[task->id].wcet_ticks == 0)
+		return 1;
 	else
+		return task_profile[task->id].wcet_ticks;
+}
+
+void scheduler::addTaskLoad(uint32_t* load, Task_t* task, uint16_t phase)
+{
+	uint32_t cost = getTaskCost(task);
+	uint16_t slot_period;
+
+	/* A task out of the PIT grid is counted in every PIT, as many times as it can be released in a PIT */
+	if((task->period % SW_PERIOD_MS) != 0)
+	{
+		cost *= (SW_PERIOD_MS + task->period - 1) / task->period;
+
+		for(uint8_t i = 0; i < SCHEDULER_LOAD_SLOT_NB; i++)
+			load[i] += cost;
+
+		return;
+	}
+
+	slot_period = task->period / SW_PERIOD_MS;
+
+	for(uint16_t i = (phase / SW_PERIOD_MS) % SCHEDULER_LOAD_SLOT_NB; i < SCHEDULER_LOAD_SLOT_NB; i += slot_period)
+		load[i] += cost;
+}
+
+uint16_t scheduler::findBestPhase(uint32_t* load, Task_t* task)
+{
+	uint32_t cost = getTaskCost(task);
+	uint16_t slot_period = task->period / SW_PERIOD_MS;
+	uint16_t nb_candidates = (slot_period < SCHEDULER_LOAD_SLOT_NB) ? slot_period : SCHEDULER_LOAD_SLOT_NB;
+	uint16_t best_slot = 0;
+	uint32_t best_peak = 0xFFFFFFFF;
+	uint32_t peak;
+
+	/* Keep the first phase giving the lowest peak */
+	for(uint16_t slot = 0; slot < nb_candidates; slot++)
+	{
+		peak = 0;
+
+		for(uint16_t i = slot; i < SCHEDULER_LOAD_SLOT_NB; i += slot_period)
+		{
+			if((load[i] + cost) > peak)
+				peak = load[i] + cost;
+		}
+
+		if(peak < best_peak)
+		{
+			best_peak = peak;
+			best_slot = slot;
+		}
+	}
+
+	return best_slot * SW_PERIOD_MS;
+}
+
+void scheduler::computeTickLoad(uint32_t* load, Task_t* excluded_task)
+{
+	for(uint8_t i = 0; i < SCHEDULER_LOAD_SLOT_NB; i++)
+		load[i] = 0;
+
+	for(uint8_t i = 0; i < heap_count; i++)
+	{
+		if(task_heap[i] != excluded_task)
+			addTaskLoad(load, task_heap[i], task_heap[i]->phase);
+	}
+}
+
+void scheduler::programNextDeadline()
+{
+	uint32_t deadline;
+	uint32_t min_deadline;
+	uint8_t sreg;
+
+	/* No task to schedule, the timer overflow will still wake up the system */
+	if(heap_count == 0)
+		return;
+
+	sreg = SREG;
+	cli();
+
+	/* If the deadline is too close or already reached, the compare match could be missed while the register is written :
+	 * the deadline is then delayed by a few ticks */
+	deadline = task_heap[0]->next_release;
+	min_deadline = getTimerTicks() + SCHEDULER_MIN_DEADLINE_TICKS;
+
+	if(isAfter(min_deadline, deadline))
+	{
+		/* The deadline is already reached : the release pass has overrun the next compare match */
+		if(!isAfter(deadline, min_deadline - SCHEDULER_MIN_DEADLINE_TICKS))
+			overrun_count++;
+
+		deadline = min_deadline;
+	}
+
+	p_global_BSW_timer->setTimer4CompareValue((uint16_t)deadline);
+
+	SREG = sreg;
+}
+
+bool scheduler::getTaskProfile(uint8_t id, TaskProfile_t* profile)
+{
+	bool result = false;
+	uint8_t sreg;
+
+	if(id >= SCHEDULER_MAX_TASK_NB)
 		return false;
+
+	/* The profile is updated by nested tasks, copy it with interrupts disabled */
+	sreg = SREG;
+	cli();
+
+	if(task_table.isAllocated(id))
+	{
+		*profile = task_profile[id];
+		result = true;
+	}
+
+	SREG = sreg;
+
+	return result;
 }
 
-bool scheduler::updateTaskPeriod(TaskPtr_t task_ptr, uint16_t period)
+void scheduler::resetTaskProfiles()
 {
+	uint8_t sreg = SREG;
+
+	cli();
+
+	for(uint8_t i = 0; i < SCHEDULER_MAX_TASK_NB; i++)
+	{
+		task_profile[i].count = 0;
+		task_profile[i].min_ticks = 0xFFFFFFFF;
+		task_profile[i].max_ticks = 0;
+		task_profile[i].total_ticks = 0;
+		task_profile[i].miss_count = 0;
+		task_profile[i].worst_lateness_ticks = 0;
+	}
+
+	SREG = sreg;
+}
+
+void scheduler::updateTaskProfile(uint8_t id, uint32_t exec_ticks)
+{
+	TaskProfile_t* profile = &task_profile[id];
+
+	/* When the counter saturates, both the counter and the sum are halved to keep the average */
+	if(profile->count == 0xFFFF)
+	{
+		profile->count >>= 1;
+		profile->total_ticks >>= 1;
+	}
+
+	profile->count++;
+	profile->total_ticks += exec_ticks;
+
+	if(exec_ticks < profile->min_ticks)
+		profile->min_ticks = exec_ticks;
+
+	if(exec_ticks > profile->max_ticks)
+		profile->max_ticks = exec_ticks;
+
+	if(exec_ticks > profile->wcet_ticks)
+		profile->wcet_ticks = exec_ticks;
+}
+
+bool scheduler::setTaskMissPolicy(TaskHandle_t handle, TaskMissPolicy_t policy)
+{
+	bool result = false;
 	Task_t* task_data_ptr;
-	bool TaskFound = false;
+	uint8_t sreg = SREG;
 
-	/* Find the task into the task chain */
-	TaskFound = TasksLL_ptr->FindElement((CompareFctPtr_t)&scheduler::LLElementCompare, (void*)task_ptr, (void**)&task_data_ptr);
+	cli();
 
-	if(TaskFound)
-		task_data_ptr->period = period;
+	task_data_ptr = getTask(handle);
+
+	/* Event tasks have no deadline */
+	if((task_data_ptr != 0) && (task_data_ptr->period != 0))
+	{
+		task_data_ptr->miss_policy = policy;
+
+		/* Delayed releases are only memorized with catch up policy */
+		if(policy != MISS_POLICY_CATCH_UP)
+			task_data_ptr->backlog = 0;
+
+		result = true;
+	}
+
+	SREG = sreg;
+
+	return result;
+}
+
+void scheduler::recordDeadlineMiss(Task_t* task, uint32_t lateness_ticks)
+{
+	TaskProfile_t* profile = &task_profile[task->id];
 
-	return TaskFound;
+	if(profile->miss_count != 0xFFFF)
+		profile->miss_count++;
+
+	if(lateness_ticks > profile->worst_lateness_ticks)
+		profile->worst_lateness_ticks = lateness_ticks;
+
+	profile->last_miss_pit = getPitNumber();
+
+	/* Degrade policy : the period is doubled, the next release is moved on the grid of the new period */
+	if((task->miss_policy == MISS_POLICY_DEGRADE) && (task->period <= 0x7FFF))
+	{
+		task->period <<= 1;
+		task->period_ticks <<= 1;
+		alignTaskPeriod(task);
+	}
+
+	if(miss_callback != 0)
+		(*miss_callback)(task->TaskPtr, lateness_ticks);
+}
+
+void scheduler::updateLoadWindow(uint32_t now)
+{
+	uint32_t window = now - load_window_start;
+
+	if(window >= SCHEDULER_PIT_TICKS)
+	{
+		if(p_global_BSW_cpuload != 0)
+			p_global_BSW_cpuload->ComputeCPULoad(load_busy_ticks, window);
+
+		load_window_start = now;
+		load_busy_ticks = 0;
+	}
 }
@@ -10,22 +10,119 @@
 #ifndef WORK_SCHEDULER_SCHEDULER_H_
 #define WORK_SCHEDULER_SCHEDULER_H_
 
-/* TODO : modify scheduler to become no more dependent of the periodic interrupt. -> continuous check of tasks to launch */
+#define SW_PERIOD_MS 500 /*!< Software period, used to define the PIT (periodic interrupt) time base and the CPU load measurement window */
+#define PRESCALER_PERIODIC_TIMER 64 /*!< Value of prescaler to use for scheduler timer (4 us resolution at 16 MHz) */
+#define SCHEDULER_TICKS_PER_MS ((F_CPU/PRESCALER_PERIODIC_TIMER)/1000) /*!< Number of scheduler timer ticks in one millisecond */
+#define SCHEDULER_PIT_TICKS ((uint32_t)SW_PERIOD_MS * SCHEDULER_TICKS_PER_MS) /*!< Number of scheduler timer ticks in one software period */
+#define SCHEDULER_TIMER_OVF_TICKS 0x10000 /*!< Number of scheduler timer ticks between two overflows of the 16-bit timer */
+#define SCHEDULER_MIN_DEADLINE_TICKS 8 /*!< Minimum distance between the current time and the programmed compare value, to be sure the compare match is not missed */
 
-#define SW_PERIOD_MS 500 /*!< Software period, used to define periodic timer interrupt */
-#define PRESCALER_PERIODIC_TIMER 256 /*!< Value of prescaler to use for periodic timer */
-#define TIMER_CTC_VALUE ((F_CPU/PRESCALER_PERIODIC_TIMER)/(1000/SW_PERIOD_MS)) /**< Compare value for periodic timer */
+#define SCHEDULER_MAX_BACKLOG 4 /*!< Maximum number of delayed releases memorized for a task using the catch up policy */
+
+#define SCHEDULER_MAX_ONESHOT_NB 8 /*!< Maximum number of pending one-shot timers */
+#define SCHEDULER_WHEEL_SLOT_NB 16 /*!< Number of slots of the one-shot timing wheel, shall be a power of 2 */
+#define SCHEDULER_WHEEL_SLOT_TICKS SCHEDULER_TICKS_PER_MS /*!< Duration of one slot of the one-shot timing wheel (ticks) */
+
+#define SCHEDULER_MAX_TASK_NB 16 /*!< Maximum number of tasks managed by the scheduler, limited by the size of the ready mask */
+#define SCHEDULER_LOAD_SLOT_NB 24 /*!< Number of PITs in the window used to estimate the load of each PIT, multiple of the usual task periods */
 
 /*!
 * @brief Type defining a pointer to function
+* @details The context given when the task has been added is passed to the task at each call.
 */
-typedef void (*TaskPtr_t)(void);
+typedef void (*TaskPtr_t)(void* context);
+
+/*!
+ * @brief Type defining the priority of a task
+ * @details A ready task is launched before all the ready tasks of lower priority, and preempts the running task if its priority is higher than the preemption threshold of the running task.
+ */
+typedef enum
+{
+	TASK_PRIO_IDLE = 0, /*!< Priority of the background loop, it can not be used by a task */
+	TASK_PRIO_LOW, /*!< Low priority : display and debug tasks */
+	TASK_PRIO_MEDIUM, /*!< Medium priority : applicative tasks */
+	TASK_PRIO_HIGH, /*!< High priority : time-critical acquisition tasks */
+	TASK_PRIO_NB /*!< Number of priority levels, including background level */
+}
+TaskPriority_t;
+
+/*!
+ * @brief Type defining a pointer to a one-shot timer function
+ * @details The argument given when the timer has been scheduled is passed to the function.
+ */
+typedef void (*OneShotPtr_t)(void* arg);
+
+/*!
+ * @brief Type defining a task handle
+ * @details The handle of a task is returned when the task is added into the scheduler. The low byte is the index of the task in the task table, also used as task identifier.
+ * 			The high byte is the generation of the table entry, which is incremented each time a task is removed : a handle of a removed task is never valid again, even if its entry is reused.
+ */
+typedef uint16_t TaskHandle_t;
+
+#define SCHEDULER_INVALID_HANDLE 0xFFFF /*!< Handle returned when a task can not be added */
+
+/*!
+ * @brief Type defining a mask of tasks
+ * @details Each bit of the mask corresponds to one task identifier.
+ */
+typedef uint16_t TaskMask_t;
+
+/*!
+ * @brief Type defining the behavior of the scheduler when a task misses its deadline
+ * @details The deadline of a periodic task is its next release. A deadline is missed if the task completes after its deadline, or if a release is dropped
+ * 			because the previous one has not been launched yet.
+ */
+typedef enum
+{
+	MISS_POLICY_SKIP = 0, /*!< Delayed releases are dropped, the task is launched once */
+	MISS_POLICY_CATCH_UP, /*!< Delayed releases are memorized (up to SCHEDULER_MAX_BACKLOG), the task is launched again for each of them */
+	MISS_POLICY_DEGRADE /*!< Delayed releases are dropped and the period of the task is doubled at each missed deadline */
+}
+TaskMissPolicy_t;
+
+/*!
+ * @brief Type defining a pointer to a deadline miss callback function
+ * @details The function is called with interrupts disabled, it receives the pointer to the late task and its lateness (ticks, 0 for a dropped release).
+ */
+typedef void (*DeadlineMissCallback_t)(TaskPtr_t task_ptr, uint32_t lateness_ticks);
+
+/*!
+ * @brief Type defining the execution time profile of a task
+ * @details All the times are net execution times : the time spent in tasks which have preempted the task is not included. Times are given in scheduler timer ticks.
+ */
+typedef struct
+{
+	TaskPtr_t TaskPtr; /*!< Pointer to the profiled task */
+	uint16_t count; /*!< Number of invocations since the last reset of the profiles */
+	uint32_t min_ticks; /*!< Minimum execution time since the last reset of the profiles */
+	uint32_t max_ticks; /*!< Maximum execution time since the last reset of the profiles */
+	uint32_t total_ticks; /*!< Sum of the execution times since the last reset of the profiles, used to compute the average */
+	uint32_t wcet_ticks; /*!< Worst case execution time since the creation of the task */
+	uint16_t miss_count; /*!< Number of missed deadlines since the last reset of the profiles */
+	uint32_t worst_lateness_ticks; /*!< Worst lateness (completion time minus deadline) since the last reset of the profiles */
+	uint32_t last_miss_pit; /*!< PIT number of the last missed deadline */
+}
+TaskProfile_t;
 
 /*!
  * @brief Scheduler class
  * @details This class defines the scheduler of the system. \n
- * 			It is called by the main interrupt and calls successively all applicative functions according to their recurrence time. \n
- * 			All tasks called by the scheduler shall have the following prototype : static void task();
+ * 			The tasks are stored in a static task table, no dynamic allocation is performed by the scheduler. A task is identified by its handle, all operations on a task are done in constant time
+ * 			and can be called from a task or an interrupt, including on the running task.\n
+ * 			The scheduler is tickless : the periodic tasks are kept in a min-heap sorted on their next release time and the compare register of the scheduler timer
+ * 			is programmed only for the next deadline. The timer is free-running, its overflows extend the 16-bit counter to a 32-bit time base.\n
+ * 			When the compare interrupt is raised, the released tasks are only posted into the ready mask and the next deadline is programmed.
+ * 			The ready tasks are then called by the background loop with interrupts enabled, then the interrupt latency is not impacted by the tasks execution.
+ * 			The CPU can sleep when no task is ready.\n
+ * 			Each task has a priority and a preemption threshold. The ready tasks are launched by decreasing priority. When a task is released by the timer while a task is running,
+ * 			it is launched directly from the compare interrupt if its priority is higher than the threshold of the running task (nested dispatch).
+ * 			The threshold allows to group tasks sharing a resource : they can not preempt each other.\n
+ * 			Each invocation of a task is timestamped with the scheduler timer, the execution time statistics of each task are kept in the profile table.\n
+ * 			One-shot timers are managed by a hashed timing wheel using the compare B channel of the scheduler timer. The expired timers are launched by an event task
+ * 			of the priority requested for the timer.\n
+ * 			The deadline of a periodic task is its next release. The missed deadlines are counted per task and handled according to the miss policy of the task.\n
+ * 			All tasks called by the scheduler shall have the following prototype : static void task(void* context); (TaskPtr_t).
+ * 			The context is the pointer given when the task is added, it is usually the object owning the task and can be 0.
  */
 class scheduler
 {
@@ -41,18 +138,58 @@ public:
 	 */
 	scheduler();
 
+	/*!
+	 * @brief Task release function
+	 * @details This function posts all the tasks whose release time has been reached into the ready mask, computes their next release time and programs the timer for the next deadline.
+	 * 			If a task is running, the released tasks with a priority higher than its preemption threshold are launched immediately.
+	 * 			It is called by the compare interrupt of the scheduler timer, with interrupts disabled.
+	 *
+	 * @return Nothing
+	 */
+	void releasePeriodicTasks();
+
 	/*!
 	 * @brief Main scheduler function
-	 * @details This function launches the scheduled tasks according to current software time and task configuration
+	 * @details This function launches all the tasks posted in the ready mask by decreasing priority, until the mask is empty. It also resets the watchdog.
+	 * 			It is called by the background loop, the tasks are executed with interrupts enabled.
+	 *
+	 * @return Nothing
+	 */
+	void dispatchReadyTasks();
+
+	/*!
+	 * @brief Ready task check function
+	 * @details This function checks if at least one task is waiting in the ready mask.
+	 *
+	 * @return True if a task is ready, false otherwise
+	 */
+	inline bool isTaskReady()
+	{
+		return (getHighestReadyPriority() != TASK_PRIO_IDLE);
+	}
+
+	/*!
+	 * @brief One-shot timer interrupt function
+	 * @details This function is called by the compare B interrupt of the scheduler timer. It moves the expired one-shot timers of the elapsed wheel slots to the expired lists,
+	 * 			activates the corresponding dispatch tasks and programs the next expiry.
+	 *
+	 * @return Nothing
+	 */
+	void oneShotInterrupt();
+
+	/*!
+	 * @brief Timer overflow function
+	 * @details This function is called by the overflow interrupt of the scheduler timer. It extends the 16-bit hardware counter to the 32-bit time base,
+	 * 			updates the PIT counter and closes the CPU load measurement window if needed.
 	 *
 	 * @return Nothing
 	 */
-	void launchPeriodicTasks();
+	void timerOverflowInterrupt();
 
 	/*!
 	 * @brief Starts the tasks scheduling
-	 * @details This function starts the timer which will trigger an interrupt every software period.
-	 * 			When the interrupt is raised the scheduler will launch applications
+	 * @details This function starts the free-running timer and programs the compare register for the first deadline.
+	 * 			When the compare interrupt is raised the scheduler will launch applications
 	 *
 	 * 	@return Nothing
 	 */
@@ -60,51 +197,229 @@ public:
 
 	/*!
 	 * @brief Add a task into the scheduler
-	 * @details This function create a new task in the scheduler linked to the function task_ptr with a period a_period and an ID a_task_id
+	 * @details This function create a new task in the scheduler linked to the function task_ptr with a period a_period.
+	 * 			The task is released for the first time at the next multiple of its period since scheduler start.
 	 *
 	 * @param [in] task_ptr Pointer to the task which will be added
-	 * @param [in] a_period Period of the new task
-	 * @return Nothing
+	 * @param [in] a_period Period of the new task (ms)
+	 * @param [in] a_priority Priority of the new task
+	 * @param [in] a_context Context given to the task at each call, usually the object owning the task
+	 * @param [in] a_threshold Preemption threshold of the new task, it is equal to the priority if not given or lower than the priority
+	 * @return Handle of the new task, SCHEDULER_INVALID_HANDLE if the maximum number of tasks is reached
+	 */
+	TaskHandle_t addPeriodicTask(TaskPtr_t task_ptr, uint16_t a_period, TaskPriority_t a_priority, void* a_context = 0, TaskPriority_t a_threshold = TASK_PRIO_IDLE);
+
+	/*!
+	 * @brief Add an event task into the scheduler
+	 * @details This function creates a new task in the scheduler linked to the function task_ptr. This task has no period, it is only launched when it is activated by function activateTask.
+	 *
+	 * @param [in] task_ptr Pointer to the task which will be added
+	 * @param [in] a_priority Priority of the new task
+	 * @param [in] a_context Context given to the task at each call, usually the object owning the task
+	 * @param [in] a_threshold Preemption threshold of the new task, it is equal to the priority if not given or lower than the priority
+	 * @return Handle of the new task, SCHEDULER_INVALID_HANDLE if the maximum number of tasks is reached
 	 */
-	void addPeriodicTask(TaskPtr_t task_ptr, uint16_t a_period);
+	TaskHandle_t addEventTask(TaskPtr_t task_ptr, TaskPriority_t a_priority, void* a_context = 0, TaskPriority_t a_threshold = TASK_PRIO_IDLE);
+
+	/*!
+	 * @brief One-shot timer creation function
+	 * @details This function schedules a call to the given function after the given delay. The function is called once, by an event task of the given priority.
+	 * 			It can be called from a task, from a one-shot function or from an interrupt.
+	 *
+	 * @param [in] fct_ptr Pointer to the function to call
+	 * @param [in] delay_ms Delay before the call (ms)
+	 * @param [in] arg Argument given to the function
+	 * @param [in] a_priority Priority of the call
+	 * @return True if the timer has been scheduled, false if the maximum number of pending timers is reached
+	 */
+	bool scheduleOnce(OneShotPtr_t fct_ptr, uint16_t delay_ms, void* arg, TaskPriority_t a_priority = TASK_PRIO_LOW);
+
+	/*!
+	 * @brief Task activation function
+	 * @details This function posts the given task into the ready mask, it will be launched by the background loop as soon as possible according to its priority.
+	 * 			It can be called from an interrupt, but it never preempts the running task.
+	 *
+	 * @param [in] handle Handle of the task to activate
+	 * @return True if the task has been activated, false if the task does not exist in the scheduler or is suspended
+	 */
+	bool activateTask(TaskHandle_t handle);
 
 	/*!
 	 * @brief Remove a task from the scheduler
-	 * @details This function finds the task defined by task_ptr in the scheduler and removes it.
-	 * @param [in] task_ptr address of the task to remove from scheduler
+	 * @details This function removes the task defined by its handle from the scheduler. If the task is waiting in the ready mask, it will not be launched.
+	 * 			The handle is no longer valid after this call.
+	 * @param [in] handle Handle of the task to remove from scheduler
 	 * @return TRUE if the task has been removed, FALSE if the task does not exist in the scheduler
 	 */
-	bool removePeriodicTask(TaskPtr_t task_ptr);
+	bool removeTask(TaskHandle_t handle);
+
+	/*!
+	 * @brief Task suspension function
+	 * @details This function suspends the given task : it is not launched anymore until it is resumed, and its pending release is cancelled.
+	 * 			A suspended periodic task stays in the deadline heap, then its release times remain on its period grid.
+	 *
+	 * @param [in] handle Handle of the task to suspend
+	 * @return True if the task has been suspended, false if the handle is not valid
+	 */
+	bool suspendTask(TaskHandle_t handle);
+
+	/*!
+	 * @brief Task resume function
+	 * @details This function resumes the given task, it will be launched again from its next release (or its next activation for an event task).
+	 *
+	 * @param [in] handle Handle of the task to resume
+	 * @return True if the task has been resumed, false if the handle is not valid
+	 */
+	bool resumeTask(TaskHandle_t handle);
+
+	/*!
+	 * @brief Handle check function
+	 * @details This function checks if the given handle corresponds to a task managed by the scheduler.
+	 *
+	 * @param [in] handle Task handle
+	 * @return True if the handle is valid, false otherwise
+	 */
+	inline bool isTaskValid(TaskHandle_t handle)
+	{
+		return (getTask(handle) != 0);
+	}
 
 	/*!
 	 * @brief Get function for PIT number
-	 * @details This function returns the PIT number
+	 * @details This function returns the PIT number, which is the number of software periods (SW_PERIOD_MS) elapsed since scheduler start.
 	 * @return PIT number
 	 */
 	uint32_t getPitNumber();
 
 	/*!
-	 * @brief Linked list comparison function
-	 * @details This function is called by the linked list class to compare one element of the list to a given element.
-	 * 			In the class scheduler, the LLElement is a task pointer (containing a function pointer and a period), and the compareElement a function pointer.
-	 * 			The comparison will be done between the two function pointer.
+	 * @brief Current time get function
+	 * @details This function returns the current value of the 32-bit time base, in scheduler timer ticks (SCHEDULER_TICKS_PER_MS ticks per millisecond).
+	 * 			The value wraps around, times shall only be compared using their difference.
 	 *
-	 * @param [in] LLElement Pointer to the linked list element
-	 * @param [in] CompareElement Pointer to the element to the compare
-	 * @return True if both elements are identical, false otherwise
+	 * @return Current time (ticks)
 	 */
-	static bool LLElementCompare(void* LLElement, void* CompareElement);
+	uint32_t getTimerTicks();
 
 	/*!
 	 * @brief Task period update function
-	 * @details This function updates the period of the given task. The task is never stopped during the process, only the period value is updated.
+	 * @details This function updates the period of the given task. The task is never stopped during the process.
+	 * 			The next release of the task is moved on the grid of the new period. In automatic phase mode, the task is placed again in the least loaded PITs.
 	 *
-	 * @param [in] task_ptr Pointer of the task to update
-	 * @param [in] period New period of the task
+	 * @param [in] handle Handle of the task to update
+	 * @param [in] period New period of the task (ms)
 	 *
 	 * @return True if the update has been correctly done, false otherwise
 	 */
-	bool updateTaskPeriod(TaskPtr_t task_ptr, uint16_t period);
+	bool updateTaskPeriod(TaskHandle_t handle, uint16_t period);
+
+	/*!
+	 * @brief Task phase update function
+	 * @details This function sets the phase offset of the given periodic task : the task is then released at each multiple of its period plus the phase.
+	 * 			The next release of the task is moved to the new grid.
+	 *
+	 * @param [in] handle Handle of the task to update
+	 * @param [in] phase Phase offset of the task (ms), lower than its period
+	 * @return True if the phase has been updated, false if the task is not valid, is an event task or the phase is not lower than the period
+	 */
+	bool setTaskPhase(TaskHandle_t handle, uint16_t phase);
+
+	/*!
+	 * @brief Automatic phase mode setting function
+	 * @details When the automatic mode is active, each new periodic task whose period is a multiple of the PIT is given the phase which minimizes the peak load of the PITs it is released in.
+	 * 			The load of a task is estimated by its worst case execution time.
+	 *
+	 * @param [in] isEnabled True to activate the automatic mode, false otherwise
+	 * @return Nothing
+	 */
+	inline void setAutoPhase(bool isEnabled)
+	{
+		isAutoPhaseEnabled = isEnabled;
+	}
+
+	/*!
+	 * @brief Task phases levelling function
+	 * @details This function computes again the phases of all the periodic tasks whose period is a multiple of the PIT, from the most to the least expensive one,
+	 * 			to minimize the peak load per PIT with the current worst case execution times. Phases set by function setTaskPhase are overwritten.
+	 * 			Interrupts are disabled during the computation, it shall not be called from a time-critical context.
+	 *
+	 * @return Nothing
+	 */
+	void balanceTaskPhases();
+
+	/*!
+	 * @brief Worst PIT load get function
+	 * @details This function estimates the load of each PIT from the worst case execution time and the release grid of the periodic tasks, and returns the highest one.
+	 * 			Tasks whose period is not a multiple of the PIT are counted in every PIT.
+	 *
+	 * @return Worst case load of a PIT (ticks)
+	 */
+	uint32_t getWorstTickLoad();
+
+	/*!
+	 * @brief Task miss policy setting function
+	 * @details This function sets the behavior of the scheduler when the given periodic task misses its deadline. The default policy is MISS_POLICY_SKIP.
+	 *
+	 * @param [in] handle Handle of the task
+	 * @param [in] policy Miss policy
+	 * @return True if the policy has been set, false if the task does not exist or is an event task
+	 */
+	bool setTaskMissPolicy(TaskHandle_t handle, TaskMissPolicy_t policy);
+
+	/*!
+	 * @brief Deadline miss callback setting function
+	 * @details This function sets the function called each time a task misses its deadline. The callback is called with interrupts disabled and shall be short.
+	 *
+	 * @param [in] callback Pointer to the callback function, 0 to disable the callback
+	 * @return Nothing
+	 */
+	inline void setDeadlineMissCallback(DeadlineMissCallback_t callback)
+	{
+		miss_callback = callback;
+	}
+
+	/*!
+	 * @brief Release pass overrun count get function
+	 * @details This function returns the number of times a release pass has overrun the next compare match : the next deadline was already reached when it has been programmed.
+	 *
+	 * @return Number of release pass overruns
+	 */
+	inline uint16_t getOverrunCount()
+	{
+		return overrun_count;
+	}
+
+	/*!
+	 * @brief Task profile get function
+	 * @details This function copies the execution time profile of the task having the given handle.
+	 *
+	 * @param [in] id Task handle (between 0 and SCHEDULER_MAX_TASK_NB - 1)
+	 * @param [out] profile Pointer to the structure where the profile is copied
+	 * @return True if a task exists with this identifier, false otherwise
+	 */
+	bool getTaskProfile(uint8_t id, TaskProfile_t* profile);
+
+	/*!
+	 * @brief Task profiles reset function
+	 * @details This function resets the execution time and deadline miss statistics of all tasks. The worst case execution times and the PIT of the last missed deadlines are kept.
+	 *
+	 * @return Nothing
+	 */
+	void resetTaskProfiles();
+
+	/*!
+	 * @brief Average execution time computation function
+	 * @details This function computes the average execution time of the given profile.
+	 *
+	 * @param [in] profile Pointer to the task profile
+	 * @return Average execution time (ticks), 0 if the task has not been invoked
+	 */
+	static inline uint32_t getAverageTicks(TaskProfile_t* profile)
+	{
+		if(profile->count == 0)
+			return 0;
+		else
+			return (profile->total_ticks / profile->count);
+	}
 
 	/*!
 	 * @brief Task count get function.
@@ -114,7 +429,7 @@ public:
 	 */
 	inline uint8_t getTaskCount()
 	{
-		return task_count;
+		return task_table.getCount();
 	}
 
 private:
@@ -124,20 +439,363 @@ private:
 	/*!
 	 * @brief Type defining a task structure
 	 * @details This structure defines a task.
-	 * 			A task is defined by a function to call (defined by its pointer) and a period.
+	 * 			A task is defined by a function to call (defined by its pointer), a period and its next release time.
+	 * 			The identifier of the task is its index in the task table and its bit in the ready mask. An event task has a period equal to 0.
 	 */
 	typedef struct Task_t
 	{
 		TaskPtr_t TaskPtr; /*!< Pointer to the task */
-		uint16_t period; /*!< Period of the task */
+		void* context; /*!< Context given to the task */
+		uint8_t id; /*!< Task identifier */
+		bool isSuspended; /*!< Flag indicating if the task is suspended */
+		TaskPriority_t priority; /*!< Priority of the task */
+		TaskPriority_t threshold; /*!< Preemption threshold of the task, the system priority is raised to this value while the task is running */
+		uint16_t period; /*!< Period of the task (ms) */
+		uint16_t phase; /*!< Phase offset of the release grid of the task (ms) */
+		uint32_t period_ticks; /*!< Period of the task (ticks) */
+		uint32_t next_release; /*!< Next release time of the task (ticks) */
+		uint8_t heap_idx; /*!< Position of the task in the deadline heap */
+		uint32_t pending_release; /*!< Release time of the invocation waiting in the ready mask (ticks) */
+		uint8_t backlog; /*!< Number of delayed releases waiting behind the pending one (catch up policy) */
+		TaskMissPolicy_t miss_policy; /*!< Behavior of the scheduler when the task misses its deadline */
 	}
 	Task_t;
 
-	uint8_t task_count; /*!< Number of task in scheduler */
+	StaticPool<Task_t, SCHEDULER_MAX_TASK_NB> task_table; /*!< Table containing the tasks */
+
+	uint8_t task_generation[SCHEDULER_MAX_TASK_NB]; /*!< Generation of each entry of the task table, incremented when a task is removed */
+
+	uint8_t heap_count; /*!< Number of periodic tasks in the deadline heap */
+
+	Task_t* task_heap[SCHEDULER_MAX_TASK_NB]; /*!< Min-heap of periodic tasks sorted on next release time */
+
+	volatile TaskMask_t ready_mask[TASK_PRIO_NB - 1]; /*!< Masks of the tasks released and waiting to be launched, one mask per priority level (background level excluded) */
+
+	volatile TaskPriority_t current_priority; /*!< System priority : preemption threshold of the running task, or background level if no task is running */
+
+	TaskProfile_t task_profile[SCHEDULER_MAX_TASK_NB]; /*!< Table of task execution time profiles, indexed by task handle */
+
+	DeadlineMissCallback_t miss_callback; /*!< Function called when a task misses its deadline, 0 if not used */
+
+	volatile uint16_t overrun_count; /*!< Number of release pass overruns */
+
+	uint32_t preempt_ticks_acc; /*!< Accumulated net execution time of all tasks, used to subtract the time of nested tasks from the execution time of the preempted task */
+
+	bool isStarted; /*!< Flag indicating if the scheduler timer has been started */
+	bool isAutoPhaseEnabled; /*!< Flag indicating if the phase of the new periodic tasks is chosen automatically */
+
+	volatile uint16_t timer_ovf_count; /*!< Number of overflows of the scheduler timer, used as the 16 upper bits of the time base */
+
+	volatile uint32_t pit_number; /*!< Counter of software periods */
+
+	volatile uint32_t pit_ticks_acc; /*!< Ticks accumulated since the last PIT counter increment, at the last timer overflow */
+
+	uint32_t load_window_start; /*!< Start time of the current CPU load measurement window (ticks) */
+
+	uint32_t load_busy_ticks; /*!< Time spent in tasks since the start of the CPU load measurement window (ticks) */
 
-	LinkedList* TasksLL_ptr; /*!< Pointer to the linked list object containing the tasks */
+	/*!
+	 * @brief Type defining a one-shot timer
+	 * @details The timers are chained in the slot of the timing wheel corresponding to their expiry time, then in the expired list of their priority.
+	 */
+	typedef struct
+	{
+		OneShotPtr_t fct_ptr; /*!< Pointer to the function to call */
+		void* arg; /*!< Argument of the function */
+		uint32_t expiry; /*!< Expiry time (ticks) */
+		TaskPriority_t priority; /*!< Priority of the call */
+		uint8_t next; /*!< Index of the next timer in the chain, STATIC_POOL_INVALID_IDX for the last one */
+	}
+	OneShot_t;
+
+	StaticPool<OneShot_t, SCHEDULER_MAX_ONESHOT_NB> oneshot_table; /*!< Table containing the one-shot timers */
+
+	uint8_t wheel[SCHEDULER_WHEEL_SLOT_NB]; /*!< Timing wheel : index of the first timer of each slot */
+
+	uint8_t wheel_count; /*!< Number of timers in the timing wheel */
+
+	uint32_t wheel_cur_slot; /*!< Absolute number of the first wheel slot not completely processed */
+
+	uint8_t expired_head[TASK_PRIO_NB - 1]; /*!< Index of the first expired timer, for each priority level */
+
+	uint8_t expired_tail[TASK_PRIO_NB - 1]; /*!< Index of the last expired timer, for each priority level */
+
+	TaskHandle_t oneshot_task_handle[TASK_PRIO_NB - 1]; /*!< Handles of the one-shot dispatch tasks, created at the first use of each priority level */
+
+	/*!
+	 * @brief Time comparison function
+	 * @details This function checks whether the given time is strictly after the reference time. The comparison is done on the difference to be robust to time base wrap-around.
+	 *
+	 * @param [in] time Time to check
+	 * @param [in] ref Reference time
+	 * @return True if time is after ref, false otherwise
+	 */
+	static inline bool isAfter(uint32_t time, uint32_t ref)
+	{
+		return ((int32_t)(time - ref) > 0);
+	}
+
+	/*!
+	 * @brief Task creation function
+	 * @details This function allocates a new task in the task table and initializes it. The task is not inserted into the deadline heap.
+	 *
+	 * @param [in] task_ptr Pointer to the task function
+	 * @param [in] a_period Period of the task (ms), 0 for an event task
+	 * @param [in] a_priority Priority of the task
+	 * @param [in] a_context Context given to the task
+	 * @param [in] a_threshold Preemption threshold of the task
+	 * @return Pointer to the new task, 0 if the task table is full or the priority is not valid
+	 */
+	Task_t* createTask(TaskPtr_t task_ptr, uint16_t a_period, TaskPriority_t a_priority, void* a_context, TaskPriority_t a_threshold);
+
+	/*!
+	 * @brief One-shot dispatch task
+	 * @details This event task is activated when a one-shot timer expires. It calls the expired timers of the priority level it is running at.
+	 *
+	 * @param [in] context Pointer to the scheduler object
+	 * @return Nothing
+	 */
+	static void oneShotDispatch_task(void* context);
+
+	/*!
+	 * @brief Expired one-shot timers launch function
+	 * @details This function calls, in expiry order, all the expired timers of the given priority level. The timers are released before being called.
+	 *
+	 * @param [in] prio Priority level
+	 * @return Nothing
+	 */
+	void runExpiredOneShots(TaskPriority_t prio);
+
+	/*!
+	 * @brief Wheel slot expiry function
+	 * @details This function moves the expired timers of the given slot of the timing wheel to the expired lists and activates the dispatch tasks. It shall be called with interrupts disabled.
+	 *
+	 * @param [in] slot Slot index in the timing wheel
+	 * @param [in] now Current time (ticks)
+	 * @return Nothing
+	 */
+	void expireWheelSlot(uint8_t slot, uint32_t now);
 
-	uint32_t pit_number; /*!< Counter of periodic interrupts */
+	/*!
+	 * @brief Programs the next one-shot expiry
+	 * @details This function searches the timing wheel, from the current slot, for the first slot containing a timer expiring during the current wheel rotation
+	 * 			and writes its expiry time into the compare B register. If there is no such timer, the compare B register is programmed at the end of the rotation.
+	 * 			The compare B interrupt is disabled if the wheel is empty. It shall be called with interrupts disabled.
+	 *
+	 * @return Nothing
+	 */
+	void programNextExpiry();
+
+	/*!
+	 * @brief Task get function
+	 * @details This function returns the task corresponding to the given handle, after checking that the handle is valid.
+	 *
+	 * @param [in] handle Task handle
+	 * @return Pointer to the task, 0 if the handle is not valid
+	 */
+	Task_t* getTask(TaskHandle_t handle);
+
+	/*!
+	 * @brief Task handle computation function
+	 * @details This function builds the handle of the task located at the given index of the task table.
+	 *
+	 * @param [in] id Index of the task in the task table
+	 * @return Task handle
+	 */
+	inline TaskHandle_t makeHandle(uint8_t id)
+	{
+		return (((TaskHandle_t)task_generation[id] << 8) | id);
+	}
+
+	/*!
+	 * @brief Task ready flag set function
+	 * @details This function posts the given task into the ready mask of its priority level. It shall be called with interrupts disabled.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @return Nothing
+	 */
+	inline void setTaskReady(Task_t* task)
+	{
+		ready_mask[task->priority - 1] |= ((TaskMask_t)1 << task->id);
+	}
+
+	/*!
+	 * @brief Task pending check function
+	 * @details This function checks if the given task is waiting in the ready mask of its priority level.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @return True if the task is waiting in the ready mask, false otherwise
+	 */
+	inline bool isTaskPending(Task_t* task)
+	{
+		return ((ready_mask[task->priority - 1] & ((TaskMask_t)1 << task->id)) != 0);
+	}
+
+	/*!
+	 * @brief Highest ready priority get function
+	 * @details This function returns the highest priority level for which at least one task is ready.
+	 *
+	 * @return Highest ready priority, TASK_PRIO_IDLE if no task is ready
+	 */
+	TaskPriority_t getHighestReadyPriority();
+
+	/*!
+	 * @brief Task dispatch function
+	 * @details This function launches, by decreasing priority, all the ready tasks whose priority is higher than the current system priority.
+	 * 			During the execution of a task, the system priority is raised to the task threshold and interrupts are enabled.
+	 * 			It shall be called with interrupts disabled, they are disabled again when the function returns.
+	 *
+	 * @return Nothing
+	 */
+	void dispatchTasks();
+
+	/*!
+	 * @brief Moves a task up in the deadline heap
+	 * @details This function moves the task at the given heap position up until the heap order is restored.
+	 *
+	 * @param [in] idx Position of the task in the heap
+	 * @return Nothing
+	 */
+	void heapSiftUp(uint8_t idx);
+
+	/*!
+	 * @brief Moves a task down in the deadline heap
+	 * @details This function moves the task at the given heap position down until the heap order is restored.
+	 *
+	 * @param [in] idx Position of the task in the heap
+	 * @return Nothing
+	 */
+	void heapSiftDown(uint8_t idx);
+
+	/*!
+	 * @brief Removes a task from the deadline heap
+	 * @details This function removes the given task from the heap. The last task of the heap is moved at its position and the heap order is restored.
+	 *
+	 * @param [in] task Pointer to the task to remove
+	 * @return Nothing
+	 */
+	void heapRemove(Task_t* task);
+
+	/*!
+	 * @brief Next release computation function
+	 * @details This function returns the first release time of the task after the current time, according to its period and phase.
+	 * 			The grid is counted from the scheduler start with the PIT number, then it stays valid after the wrap around of the time base. Interrupts shall be disabled.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @return Next release time of the task (ticks)
+	 */
+	uint32_t getNextGridRelease(Task_t* task);
+
+	/*!
+	 * @brief PIT time get function
+	 * @details This function reads in a single access the current time, the PIT number and the number of ticks elapsed since the start of the PIT.
+	 *
+	 * @param [out] pit PIT number
+	 * @param [out] pit_ticks Number of ticks elapsed in the current PIT
+	 * @return Current time (ticks)
+	 */
+	uint32_t getPitTime(uint32_t* pit, uint32_t* pit_ticks);
+
+	/*!
+	 * @brief Task phase application function
+	 * @details This function sets the phase of the given periodic task and moves its next release in the deadline heap. Interrupts shall be disabled.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @param [in] phase New phase of the task (ms)
+	 * @return Nothing
+	 */
+	void applyTaskPhase(Task_t* task, uint16_t phase);
+
+	/*!
+	 * @brief Task grid alignment function
+	 * @details This function is called after a period change of a periodic task. In automatic mode, a task whose period is a multiple of the PIT is given the best phase
+	 * 			for its new period, otherwise its phase is kept modulo the new period. The next release is then moved on the new grid. Interrupts shall be disabled.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @return Nothing
+	 */
+	void alignTaskPeriod(Task_t* task);
+
+	/*!
+	 * @brief Task cost get function
+	 * @details This function returns the cost of a task used for the PIT load estimation : its worst case execution time, or 1 tick if it has never been measured.
+	 *
+	 * @param [in] task Pointer to the task
+	 * @return Cost of the task (ticks)
+	 */
+	uint32_t getTaskCost(Task_t* task);
+
+	/*!
+	 * @brief Task load accumulation function
+	 * @details This function adds the cost of the task in the load table, in all the PITs of the window where the task is released with the given phase.
+	 *
+	 * @param [in,out] load Load table of SCHEDULER_LOAD_SLOT_NB PITs
+	 * @param [in] task Pointer to the task
+	 * @param [in] phase Phase of the task (ms)
+	 * @return Nothing
+	 */
+	void addTaskLoad(uint32_t* load, Task_t* task, uint16_t phase);
+
+	/*!
+	 * @brief Best phase search function
+	 * @details This function returns the phase, multiple of the PIT, which minimizes the peak load of the PITs where the task would be released.
+	 * 			The task period shall be a multiple of the PIT.
+	 *
+	 * @param [in] load Load table of SCHEDULER_LOAD_SLOT_NB PITs, without the task
+	 * @param [in] task Pointer to the task
+	 * @return Best phase of the task (ms)
+	 */
+	uint16_t findBestPhase(uint32_t* load, Task_t* task);
+
+	/*!
+	 * @brief PIT load computation function
+	 * @details This function fills the load table with the estimated load of the periodic tasks of the deadline heap.
+	 *
+	 * @param [out] load Load table of SCHEDULER_LOAD_SLOT_NB PITs
+	 * @param [in] excluded_task Pointer to a task whose load is not counted, 0 to count all the tasks
+	 * @return Nothing
+	 */
+	void computeTickLoad(uint32_t* load, Task_t* excluded_task = 0);
+
+	/*!
+	 * @brief Programs the next deadline
+	 * @details This function writes the release time of the first task of the heap into the compare register of the scheduler timer.
+	 * 			If this release time is already reached or too close, the compare register is programmed SCHEDULER_MIN_DEADLINE_TICKS ticks in the future.
+	 *
+	 * @return Nothing
+	 */
+	void programNextDeadline();
+
+	/*!
+	 * @brief Task profile update function
+	 * @details This function updates the execution time statistics of the task having the given identifier with a new measure. It shall be called with interrupts disabled.
+	 *
+	 * @param [in] id Task identifier
+	 * @param [in] exec_ticks Net execution time of the task (ticks)
+	 * @return Nothing
+	 */
+	void updateTaskProfile(uint8_t id, uint32_t exec_ticks);
+
+	/*!
+	 * @brief Deadline miss recording function
+	 * @details This function updates the deadline miss statistics of the given task, applies the degrade policy and calls the deadline miss callback.
+	 * 			With the degrade policy, the next release of the task is moved on the grid of the doubled period.
+	 * 			It shall be called with interrupts disabled.
+	 *
+	 * @param [in] task Pointer to the late task
+	 * @param [in] lateness_ticks Lateness of the task (ticks), 0 for a dropped release
+	 * @return Nothing
+	 */
+	void recordDeadlineMiss(Task_t* task, uint32_t lateness_ticks);
+
+	/*!
+	 * @brief CPU load window update function
+	 * @details This function computes the CPU load when the measurement window (SW_PERIOD_MS) has elapsed and starts a new window.
+	 *
+	 * @param [in] now Current time (ticks)
+	 * @return Nothing
+	 */
+	void updateLoadWindow(uint32_t now);
 
 };
 